@@ -1,6 +1,8 @@
 ; This file is for the FamiTone2 library and was generated by FamiStudio
 
 
+.segment "MUSIC"		;switchable music bank on MMC1, see mapper.h
+
 .export _hornet_music_data = music_data_untitled_2
 
 
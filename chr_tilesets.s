@@ -0,0 +1,414 @@
+; Generated by tools/chr_pack.py, do not edit
+;tileset_bg_main=game_tileset_1.chr@0 tileset_spr=game_tileset_1.chr@0x1000 tileset_bg_crossroads=assets/chr/crossroads_bg.chr:banked
+
+	.include "mapper.inc"
+
+.if(NES_CHR_RAM)
+
+	.export NES_CHR_BANKS	;no CHR-ROM in the iNES header
+NES_CHR_BANKS = 0
+
+.segment "TILESETS"	;switchable bank on MMC1/MMC3, see mapper.h
+
+	.export _tileset_bg_main
+
+_tileset_bg_main:	;2330 bytes (56%)
+	.byte $13,$00,$13,$17,$ff,$13,$0f,$00,$13,$07,$ff,$13,$0f,$55,$aa,$55
+	.byte $aa,$55,$aa,$55,$aa,$00,$13,$07,$55,$aa,$55,$aa,$55,$aa,$55,$aa
+	.byte $55,$aa,$55,$aa,$55,$aa,$55,$aa,$00,$13,$07,$55,$aa,$55,$aa,$55
+	.byte $aa,$55,$aa,$ff,$13,$07,$aa,$55,$aa,$55,$aa,$55,$aa,$55,$aa,$55
+	.byte $aa,$55,$aa,$55,$aa,$55,$ff,$13,$07,$aa,$55,$aa,$55,$aa,$55,$aa
+	.byte $55,$55,$aa,$55,$aa,$55,$aa,$55,$aa,$33,$cc,$33,$cc,$33,$cc,$33
+	.byte $cc,$00,$13,$07,$33,$cc,$33,$cc,$33,$cc,$33,$cc,$33,$cc,$33,$cc
+	.byte $33,$cc,$33,$cc,$00,$13,$07,$33,$cc,$33,$cc,$33,$cc,$33,$cc,$ff
+	.byte $13,$07,$cc,$33,$cc,$33,$cc,$33,$cc,$33,$cc,$33,$cc,$33,$cc,$33
+	.byte $cc,$33,$ff,$13,$07,$cc,$33,$cc,$33,$cc,$33,$cc,$33,$33,$cc,$33
+	.byte $cc,$33,$cc,$33,$cc,$3e,$7f,$13,$05,$3e,$3c,$42,$5a,$52,$5a,$42
+	.byte $3c,$00,$fe,$ff,$7f,$7b,$7b,$00,$13,$02,$f4,$4a,$52,$52,$00,$13
+	.byte $a3,$18,$3c,$7e,$ff,$ff,$db,$18,$18,$10,$38,$7c,$d6,$92,$10,$10
+	.byte $00,$18,$18,$db,$ff,$ff,$7e,$3c,$18,$10,$10,$92,$d6,$7c,$38,$10
+	.byte $00,$1c,$3c,$78,$ff,$ff,$78,$3c,$1c,$18,$30,$60,$fe,$60,$30,$18
+	.byte $00,$38,$3c,$1e,$ff,$ff,$1e,$3c,$38,$30,$18,$0c,$fe,$0c,$18,$30
+	.byte $00,$13,$10,$3c,$13,$02,$38,$13,$06,$30,$13,$02,$00,$30,$00,$3c
+	.byte $13,$03,$00,$13,$03,$28,$13,$02,$00,$13,$85,$18,$18,$7e,$7e,$18
+	.byte $18,$00,$00,$10,$10,$7c,$10,$10,$00,$13,$05,$38,$38,$78,$70,$00
+	.byte $13,$03,$30,$30,$60,$00,$13,$03,$3e,$3e,$00,$13,$05,$3c,$00,$13
+	.byte $08,$38,$13,$02,$00,$13,$04,$30,$30,$00,$00,$38,$7c,$7c,$7e,$13
+	.byte $02,$3e,$00,$30,$48,$30,$5c,$48,$34,$00,$3c,$7e,$13,$05,$3c,$38
+	.byte $6c,$13,$04,$38,$00,$1c,$3c,$3c,$1c,$13,$04,$18,$38,$18,$13,$04
+	.byte $00,$3c,$7e,$7e,$3e,$7c,$7e,$13,$02,$38,$6c,$0c,$38,$60,$6c,$7c
+	.byte $00,$3c,$7e,$7e,$3e,$3e,$7e,$7e,$3c,$38,$6c,$0c,$38,$0c,$6c,$38
+	.byte $00,$7e,$13,$04,$0e,$13,$02,$6c,$13,$02,$7c,$0c,$13,$02,$00,$7e
+	.byte $13,$02,$7c,$7e,$13,$02,$3c,$7c,$6c,$60,$78,$0c,$6c,$38,$00,$3c
+	.byte $7e,$7e,$7c,$7e,$13,$02,$3c,$38,$6c,$60,$78,$6c,$6c,$38,$00,$7e
+	.byte $13,$03,$0e,$13,$03,$7c,$6c,$6c,$0c,$13,$03,$00,$3c,$7e,$13,$05
+	.byte $3c,$38,$6c,$6c,$38,$6c,$6c,$38,$00,$3c,$7e,$13,$02,$3e,$7e,$7e
+	.byte $3c,$38,$6c,$6c,$3c,$0c,$6c,$38,$00,$13,$50,$3c,$7e,$7e,$1e,$3c
+	.byte $38,$13,$03,$6c,$0c,$18,$30,$00,$30,$00,$3c,$7e,$13,$05,$3e,$38
+	.byte $44,$5c,$54,$5c,$40,$3c,$00,$3e,$7f,$77,$7f,$7f,$77,$13,$02,$3c
+	.byte $66,$66,$7e,$66,$13,$02,$00,$7e,$7f,$77,$7f,$7f,$77,$7f,$7e,$7c
+	.byte $66,$66,$7c,$66,$66,$7c,$00,$3e,$7f,$77,$70,$70,$77,$7f,$3e,$3c
+	.byte $66,$60,$13,$02,$66,$3c,$00,$7c,$7e,$7f,$77,$77,$7f,$7e,$7c,$78
+	.byte $6c,$66,$13,$02,$6c,$78,$00,$7f,$7f,$70,$7f,$7f,$70,$7f,$7f,$7e
+	.byte $60,$60,$7e,$60,$60,$7e,$00,$7f,$7f,$70,$7c,$7c,$70,$13,$02,$7e
+	.byte $60,$60,$78,$60,$13,$02,$00,$3e,$7f,$77,$7f,$7f,$77,$7f,$3e,$3c
+	.byte $66,$60,$6e,$66,$66,$3c,$00,$77,$13,$02,$7f,$7f,$77,$13,$02,$66
+	.byte $13,$02,$7e,$66,$13,$02,$00,$7f,$7f,$1c,$13,$03,$7f,$7f,$7e,$18
+	.byte $13,$04,$7e,$00,$07,$13,$03,$77,$77,$7f,$3e,$06,$13,$03,$66,$66
+	.byte $3c,$00,$77,$7f,$7e,$7c,$7c,$7e,$7f,$77,$66,$6c,$78,$70,$78,$6c
+	.byte $66,$00,$70,$13,$05,$7f,$7f,$60,$13,$05,$7e,$00,$fe,$ff,$13,$03
+	.byte $e7,$13,$02,$ec,$fe,$d6,$d6,$c6,$13,$02,$00,$77,$7f,$13,$04,$77
+	.byte $77,$66,$76,$7e,$7e,$6e,$66,$66,$00,$3e,$7f,$77,$13,$03,$7f,$3e
+	.byte $3c,$66,$13,$04,$3c,$00,$7e,$7f,$77,$7f,$7e,$70,$13,$02,$7c,$66
+	.byte $66,$7c,$60,$13,$02,$00,$3e,$7f,$77,$13,$02,$7f,$7f,$3f,$3c,$66
+	.byte $13,$03,$6c,$3e,$00,$7e,$7f,$77,$7f,$7e,$7e,$7f,$77,$7c,$66,$66
+	.byte $7c,$78,$6c,$66,$00,$3e,$7f,$77,$7e,$3f,$77,$7f,$3e,$3c,$66,$60
+	.byte $3c,$06,$66,$3c,$00,$7f,$7f,$1c,$13,$05,$7e,$18,$13,$05,$00,$77
+	.byte $13,$05,$7f,$3e,$66,$13,$05,$3c,$00,$77,$13,$03,$7f,$3e,$3e,$1c
+	.byte $66,$13,$03,$3c,$3c,$18,$00,$e7,$e7,$ff,$13,$04,$7e,$c6,$c6,$d6
+	.byte $13,$02,$fe,$6c,$00,$77,$77,$7f,$3e,$3e,$7f,$77,$77,$66,$66,$3c
+	.byte $18,$3c,$66,$66,$00,$77,$13,$02,$7f,$3e,$1c,$13,$02,$66,$13,$02
+	.byte $3c,$18,$13,$02,$00,$7f,$7f,$0f,$1e,$3c,$78,$7f,$7f,$7e,$06,$0c
+	.byte $18,$30,$60,$7e,$00,$ff,$13,$07,$fc,$f8,$13,$02,$fc,$f8,$f8,$fc
+	.byte $ff,$13,$07,$3f,$1f,$1f,$3f,$1f,$13,$02,$3f,$00,$7f,$4c,$5f,$79
+	.byte $7f,$57,$5f,$ff,$13,$07,$00,$ff,$44,$ff,$99,$ff,$13,$0a,$00,$fe
+	.byte $c2,$fa,$9e,$fe,$ea,$fa,$ff,$13,$07,$00,$13,$1a,$01,$02,$04,$04
+	.byte $03,$00,$13,$0a,$80,$40,$80,$03,$04,$00,$13,$0b,$30,$48,$40,$b8
+	.byte $00,$13,$08,$06,$02,$04,$09,$0a,$0c,$ca,$00,$13,$08,$60,$40,$20
+	.byte $90,$50,$30,$53,$00,$13,$0b,$0c,$12,$02,$1d,$00,$13,$0a,$01,$02
+	.byte $01,$c0,$20,$00,$13,$0a,$80,$40,$20,$20,$c0,$00,$13,$17,$08,$13
+	.byte $07,$00,$13,$0b,$0f,$08,$13,$02,$00,$13,$0b,$f8,$08,$13,$02,$5f
+	.byte $57,$77,$5f,$5f,$57,$77,$5f,$ff,$13,$14,$91,$00,$00,$fa,$ee,$ea
+	.byte $fa,$fa,$ee,$ea,$fa,$ff,$13,$07,$00,$13,$08,$03,$04,$09,$09,$06
+	.byte $00,$13,$09,$c0,$33,$0c,$60,$18,$00,$13,$0a,$84,$49,$30,$00,$13
+	.byte $0c,$85,$02,$12,$22,$24,$18,$00,$13,$09,$29,$24,$12,$11,$0c,$02
+	.byte $04,$00,$13,$08,$94,$24,$48,$88,$30,$40,$20,$00,$13,$08,$a1,$40
+	.byte $48,$44,$24,$18,$00,$13,$09,$21,$92,$0c,$00,$13,$0c,$03,$cc,$30
+	.byte $06,$18,$00,$13,$0b,$c0,$20,$90,$90,$60,$00,$13,$0d,$ff,$00,$13
+	.byte $0a,$08,$13,$03,$0f,$00,$13,$0a,$08,$13,$03,$f8,$00,$13,$02,$5f
+	.byte $57,$7f,$79,$5f,$4c,$7f,$00,$ff,$13,$0a,$99,$ff,$44,$ff,$00,$62
+	.byte $ff,$13,$06,$fa,$ea,$fe,$9e,$fa,$c2,$fe,$00,$ff,$13,$07,$00,$13
+	.byte $9f,$ff,$13,$07,$00,$00,$91,$ff,$13,$06,$7f,$ff,$7f,$ff,$7f,$ff
+	.byte $19,$d9,$80,$0e,$86,$20,$e4,$ce,$00,$60,$08,$14,$10,$10,$02,$01
+	.byte $60,$ff,$2c,$36,$31,$35,$2b,$27,$00,$00,$0a,$11,$00,$00,$10,$08
+	.byte $00,$ff,$9b,$31,$40,$51,$5a,$39,$00,$00,$02,$05,$01,$01,$84,$42
+	.byte $00,$ff,$26,$8d,$51,$55,$d6,$ce,$00,$80,$00,$13,$05,$c0,$e0,$80
+	.byte $13,$05,$00,$13,$0f,$33,$ff,$7f,$ff,$ff,$7f,$7f,$ff,$df,$dc,$c0
+	.byte $03,$db,$d8,$d0,$83,$9d,$ff,$13,$06,$f7,$e7,$00,$66,$26,$18,$b9
+	.byte $83,$cc,$ff,$fe,$ff,$ff,$fe,$fe,$ff,$fb,$3b,$03,$c0,$db,$1b,$0b
+	.byte $c1,$00,$13,$13,$03,$06,$1c,$77,$00,$13,$04,$01,$03,$0f,$00,$13
+	.byte $02,$e0,$40,$20,$38,$ef,$00,$13,$03,$80,$c0,$c0,$f0,$00,$13,$50
+	.byte $1b,$00,$13,$05,$3f,$13,$02,$28,$13,$02,$aa,$6c,$00,$de,$00,$13
+	.byte $05,$ff,$13,$02,$00,$13,$05,$ed,$00,$13,$05,$ff,$13,$02,$01,$13
+	.byte $02,$05,$03,$00,$80,$00,$13,$05,$c0,$13,$02,$40,$13,$02,$50,$60
+	.byte $00,$13,$0f,$ff,$ff,$7f,$7f,$ff,$ff,$7f,$ff,$19,$d9,$c0,$ce,$86
+	.byte $e0,$e4,$ce,$ff,$13,$07,$9b,$03,$72,$60,$0e,$2c,$60,$06,$ff,$ff
+	.byte $fe,$fe,$ff,$ff,$fe,$ff,$98,$9b,$03,$73,$61,$07,$27,$73,$00,$13
+	.byte $0f,$df,$f8,$e0,$c0,$c0,$80,$98,$bc,$38,$67,$5f,$3f,$3f,$7f,$67
+	.byte $43,$f1,$1c,$06,$03,$03,$01,$19,$3d,$1e,$e7,$fb,$fd,$fd,$fe,$e6
+	.byte $c2,$87,$cd,$79,$03,$e0,$ff,$7f,$00,$00,$02,$86,$fc,$ff,$3f,$00
+	.byte $00,$03,$0d,$39,$c3,$1e,$f8,$e0,$00,$00,$02,$06,$3e,$f8,$e0,$00
+	.byte $00,$df,$f8,$e0,$c0,$c0,$80,$98,$bc,$38,$60,$40,$00,$13,$04,$f1
+	.byte $1c,$06,$03,$03,$01,$19,$3d,$1e,$07,$03,$01,$01,$00,$13,$62,$ff
+	.byte $7f,$7f,$ff,$ff,$7f,$ff,$33,$83,$d0,$d8,$db,$03,$c0,$dc,$df,$ff
+	.byte $13,$06,$9d,$83,$b9,$18,$26,$66,$00,$e7,$f7,$ff,$fe,$fe,$ff,$ff
+	.byte $fe,$ff,$cc,$c1,$0b,$1b,$db,$c0,$03,$3b,$fb,$00,$13,$0f,$be,$be
+	.byte $9e,$46,$70,$3f,$1f,$07,$41,$41,$61,$39,$3f,$1f,$07,$00,$7d,$7d
+	.byte $79,$62,$0e,$fc,$f8,$e0,$82,$82,$86,$9c,$fc,$f8,$e0,$00,$3c,$4e
+	.byte $8f,$af,$af,$4e,$2c,$18,$00,$3c,$7e,$5a,$5a,$3c,$18,$00,$3c,$42
+	.byte $81,$a5,$a5,$42,$24,$18,$00,$13,$07,$be,$be,$9e,$46,$40,$20,$18
+	.byte $07,$00,$13,$07,$7d,$7d,$79,$62,$02,$04,$18,$e0,$00,$13,$19,$7e
+	.byte $7e,$3c,$13,$02,$ff,$00,$00,$7e,$00,$04,$08,$10,$20,$03,$0f,$1c
+	.byte $38,$33,$74,$64,$65,$00,$08,$10,$20,$00,$13,$02,$60,$98,$f8,$78
+	.byte $38,$38,$b8,$13,$02,$00,$13,$02,$20,$13,$04,$00,$13,$34,$02,$07
+	.byte $0f,$01,$03,$1f,$07,$18,$22,$47,$4a,$00,$13,$06,$80,$80,$c0,$f8
+	.byte $e0,$18,$44,$22,$92,$00,$00,$03,$07,$07,$0f,$0f,$1f,$00,$00,$03
+	.byte $04,$04,$08,$08,$10,$3f,$ff,$ff,$f3,$13,$02,$ff,$ff,$3f,$c0,$4c
+	.byte $5e,$13,$02,$4c,$21,$fc,$ff,$13,$06,$fc,$83,$80,$13,$04,$00,$13
+	.byte $02,$c0,$e0,$e0,$f0,$f0,$f8,$00,$00,$c0,$20,$20,$10,$10,$08,$00
+	.byte $13,$41,$38,$64,$c3,$7e,$66,$c3,$00,$13,$05,$3c,$7e,$f4,$93,$00
+	.byte $13,$05,$04,$f2,$f0,$00,$13,$04,$38,$d8,$18,$13,$05,$00,$18,$00
+	.byte $13,$04,$18,$00,$13,$2f,$0f,$0f,$07,$07,$03,$01,$01,$00,$48,$4a
+	.byte $45,$47,$53,$49,$21,$1f,$80,$c8,$d8,$f8,$f8,$f0,$e0,$00,$82,$82
+	.byte $da,$fa,$3a,$f2,$c4,$f8,$1f,$3f,$3f,$7f,$13,$04,$10,$20,$20,$40
+	.byte $13,$04,$ff,$13,$03,$f8,$c7,$ca,$8a,$1e,$00,$00,$0f,$3f,$7f,$7f
+	.byte $ff,$13,$03,$fc,$fc,$1f,$9f,$8f,$00,$00,$03,$87,$e7,$f3,$f0,$f8
+	.byte $f8,$fc,$fc,$fe,$13,$04,$08,$04,$04,$82,$82,$02,$13,$02,$07,$00
+	.byte $00,$0f,$01,$01,$0f,$01,$07,$3f,$07,$0f,$ff,$1f,$0f,$7f,$00,$13
+	.byte $2f,$03,$07,$0e,$0c,$1c,$1d,$13,$02,$03,$04,$08,$00,$10,$00,$13
+	.byte $02,$c0,$f0,$38,$1c,$cc,$2e,$26,$a6,$00,$10,$08,$04,$00,$13,$02
+	.byte $06,$18,$13,$07,$00,$13,$03,$18,$00,$13,$16,$06,$06,$10,$38,$10
+	.byte $18,$1c,$1f,$19,$19,$1f,$27,$00,$13,$03,$60,$60,$08,$1c,$08,$18
+	.byte $38,$f8,$98,$98,$f8,$e4,$00,$13,$04,$03,$07,$07,$00,$13,$04,$03
+	.byte $06,$05,$00,$13,$04,$80,$e0,$f0,$00,$13,$04,$80,$60,$10,$ff,$13
+	.byte $07,$80,$13,$02,$81,$13,$04,$92,$13,$02,$12,$22,$25,$13,$02,$ff
+	.byte $13,$07,$4f,$13,$02,$47,$27,$13,$03,$f8,$13,$02,$fc,$13,$04,$ff
+	.byte $13,$07,$01,$13,$07,$f9,$49,$49,$48,$00,$13,$03,$ff,$13,$02,$fa
+	.byte $b2,$92,$90,$10,$80,$f0,$80,$80,$f0,$00,$00,$e0,$fe,$f0,$f8,$ff
+	.byte $f0,$e0,$fc,$e0,$00,$13,$1f,$1c,$1b,$18,$13,$05,$00,$18,$00,$13
+	.byte $04,$18,$2f,$c9,$00,$13,$05,$20,$4f,$0f,$00,$13,$04,$18,$18,$7e
+	.byte $7e,$3c,$13,$03,$00,$00,$7e,$00,$04,$08,$10,$20,$00,$13,$0f,$3f
+	.byte $13,$05,$1f,$1f,$30,$2f,$20,$30,$2f,$20,$18,$17,$fc,$13,$05,$f8
+	.byte $f8,$0c,$f4,$04,$0c,$f4,$04,$18,$e8,$0f,$1f,$13,$02,$3f,$7f,$13
+	.byte $02,$09,$10,$10,$1b,$24,$42,$73,$41,$f0,$f8,$fc,$13,$02,$fe,$13
+	.byte $02,$50,$68,$84,$14,$24,$1a,$22,$62,$00,$00,$40,$60,$20,$22,$66
+	.byte $f6,$00,$00,$40,$60,$20,$22,$66,$f6,$00,$13,$03,$24,$45,$d7,$d4
+	.byte $00,$13,$03,$24,$45,$d7,$d4,$00,$00,$04,$0c,$45,$46,$c4,$e4,$00
+	.byte $00,$04,$0c,$45,$46,$c4,$e4,$00,$13,$13,$48,$49,$49,$f9,$10,$90
+	.byte $92,$b2,$fa,$ff,$13,$02,$3c,$4a,$bd,$e7,$bf,$d9,$7e,$3c,$00,$34
+	.byte $62,$1a,$50,$66,$2c,$00,$13,$20,$3c,$ff,$3c,$13,$02,$7e,$ff,$ff
+	.byte $04,$08,$10,$20,$00,$3c,$00,$13,$11,$3c,$13,$04,$7e,$ff,$ff,$04
+	.byte $08,$10,$20,$00,$3c,$00,$13,$11,$13,$00
+
+	.export _tileset_spr
+
+_tileset_spr:	;1484 bytes (36%)
+	.byte $0a,$00,$0a,$04,$03,$03,$00,$18,$10,$10,$1f,$1f,$1c,$1c,$5f,$00
+	.byte $0a,$04,$40,$40,$00,$c0,$40,$40,$c0,$c0,$80,$80,$c0,$1f,$1f,$3f
+	.byte $0a,$03,$3d,$05,$60,$2f,$1e,$1c,$18,$10,$00,$00,$c0,$0a,$05,$80
+	.byte $00,$00,$c0,$c0,$40,$00,$0a,$1c,$06,$04,$04,$07,$0a,$02,$47,$00
+	.byte $0a,$05,$d0,$d0,$00,$30,$10,$10,$f0,$f0,$20,$20,$00,$0f,$1f,$3f
+	.byte $0a,$02,$3e,$0c,$67,$30,$0f,$1e,$18,$10,$00,$0a,$02,$f0,$0a,$03
+	.byte $e0,$60,$60,$f0,$00,$f0,$30,$10,$00,$0a,$17,$03,$03,$00,$18,$10
+	.byte $10,$1f,$1f,$1c,$9c,$df,$00,$0a,$04,$40,$40,$00,$c0,$40,$40,$c0
+	.byte $c0,$80,$80,$c0,$1f,$3f,$7f,$ff,$ff,$7c,$18,$10,$60,$1f,$3c,$70
+	.byte $60,$00,$0a,$02,$c0,$0a,$02,$80,$0a,$02,$00,$0a,$02,$c0,$c0,$00
+	.byte $0a,$2a,$03,$03,$00,$18,$10,$10,$1f,$1f,$1c,$1c,$00,$0a,$05,$40
+	.byte $40,$00,$c0,$40,$40,$c0,$c0,$80,$80,$00,$1f,$1f,$3f,$0a,$02,$3d
+	.byte $05,$5f,$60,$2f,$1c,$18,$10,$00,$0a,$02,$c0,$0a,$04,$80,$00,$c0
+	.byte $00,$c0,$40,$00,$0a,$1c,$06,$04,$04,$07,$0a,$02,$47,$00,$0a,$05
+	.byte $d0,$d0,$00,$30,$10,$10,$f0,$f0,$20,$20,$00,$0f,$1f,$3f,$0a,$03
+	.byte $0f,$67,$30,$2f,$1e,$1c,$18,$00,$0a,$02,$f0,$0a,$03,$e0,$c0,$80
+	.byte $f0,$00,$f0,$70,$30,$00,$0a,$cb,$06,$04,$04,$07,$0a,$02,$47,$00
+	.byte $0a,$05,$d0,$d0,$00,$30,$10,$10,$f0,$f0,$20,$20,$00,$0f,$1f,$3f
+	.byte $0a,$02,$3e,$0c,$67,$30,$2f,$1c,$18,$10,$00,$0a,$02,$f0,$0a,$03
+	.byte $e0,$70,$30,$f0,$00,$f0,$70,$10,$00,$0a,$17,$03,$c3,$e0,$18,$10
+	.byte $10,$1f,$1f,$1c,$1c,$5f,$00,$0a,$04,$40,$40,$00,$c0,$40,$40,$c0
+	.byte $c0,$80,$80,$c0,$ff,$0a,$02,$3f,$1f,$0f,$1c,$18,$60,$7f,$1f,$03
+	.byte $00,$0a,$03,$c0,$0a,$06,$00,$00,$c0,$c0,$00,$0a,$2c,$0c,$08,$08
+	.byte $1f,$0a,$03,$5f,$00,$0a,$04,$40,$00,$00,$c0,$40,$40,$c0,$c0,$80
+	.byte $80,$c0,$1f,$0f,$27,$33,$33,$3f,$3d,$0d,$60,$3f,$1f,$1e,$1c,$10
+	.byte $00,$00,$c0,$0a,$06,$80,$00,$c0,$0a,$02,$40,$00,$0a,$ca,$03,$02
+	.byte $02,$03,$23,$33,$1b,$0f,$00,$0a,$05,$20,$20,$30,$10,$10,$f0,$0a
+	.byte $02,$d0,$d0,$7f,$ff,$ff,$bf,$1f,$3f,$38,$30,$00,$7c,$38,$10,$00
+	.byte $0a,$04,$f0,$0a,$02,$e0,$c0,$0a,$02,$f0,$00,$30,$60,$40,$00,$0a
+	.byte $1a,$fc,$2f,$17,$0b,$05,$02,$01,$00,$0a,$09,$c0,$e0,$f8,$fc,$fe
+	.byte $7f,$bf,$00,$0a,$08,$01,$02,$05,$0b,$17,$2f,$fc,$00,$0a,$07,$bf
+	.byte $7f,$fe,$fc,$f8,$e0,$c0,$00,$0a,$18,$80,$86,$a4,$04,$07,$47,$67
+	.byte $37,$00,$0a,$05,$d0,$d0,$01,$31,$11,$10,$f4,$f4,$20,$20,$78,$7f
+	.byte $7f,$37,$17,$37,$30,$30,$07,$38,$3f,$0b,$08,$08,$88,$00,$00,$f0
+	.byte $0a,$02,$e0,$c0,$0a,$02,$f0,$02,$f2,$e2,$42,$12,$00,$0a,$27,$01
+	.byte $01,$00,$0c,$08,$08,$0f,$0f,$0e,$0e,$00,$0a,$05,$a0,$a0,$00,$60
+	.byte $20,$20,$e0,$e0,$40,$40,$00,$0f,$63,$ff,$ff,$7f,$38,$30,$ef,$70
+	.byte $3c,$70,$70,$20,$00,$0a,$02,$e0,$0a,$04,$c0,$c0,$e0,$00,$60,$20
+	.byte $00,$0a,$69,$01,$01,$00,$8c,$08,$08,$2f,$0f,$0e,$8e,$00,$0a,$05
+	.byte $a0,$a0,$00,$60,$24,$20,$e0,$e2,$40,$40,$00,$1f,$7f,$ff,$f7,$7f
+	.byte $38,$30,$cf,$60,$3f,$7c,$78,$20,$00,$0a,$02,$e0,$e0,$c0,$e0,$e0
+	.byte $c0,$c0,$e0,$08,$e0,$60,$20,$00,$0a,$7a,$03,$07,$0f,$1f,$1f,$3f
+	.byte $7e,$7d,$00,$0a,$07,$c0,$e0,$f0,$f8,$f8,$fc,$7e,$be,$00,$0a,$07
+	.byte $7a,$74,$e8,$d0,$a0,$c0,$80,$80,$00,$0a,$07,$5e,$2e,$17,$0b,$05
+	.byte $03,$01,$01,$00,$0a,$15,$01,$01,$00,$0c,$08,$08,$0f,$0f,$0e,$0e
+	.byte $00,$0a,$05,$a0,$a0,$00,$60,$20,$20,$e0,$e0,$40,$40,$00,$1f,$7f
+	.byte $ff,$ff,$7f,$38,$30,$cf,$60,$3f,$7c,$78,$20,$00,$0a,$02,$e0,$0a
+	.byte $04,$c0,$c0,$e0,$00,$e0,$60,$20,$00,$0a,$22,$09,$1f,$1f,$3f,$3f
+	.byte $71,$3f,$29,$00,$00,$0d,$09,$1b,$0e,$00,$00,$b0,$f8,$f0,$e5,$e5
+	.byte $b0,$fe,$48,$04,$26,$2f,$7a,$5a,$4f,$00,$0a,$e1,$09,$1f,$1f,$3f
+	.byte $7b,$31,$3f,$11,$00,$00,$0d,$09,$1f,$0e,$00,$00,$b0,$f8,$f0,$e0
+	.byte $e5,$25,$f0,$12,$00,$24,$2e,$7f,$5a,$da,$0f,$00,$0a,$35,$03,$03
+	.byte $00,$18,$10,$10,$1f,$1f,$1c,$1c,$5f,$00,$0a,$04,$40,$40,$00,$c0
+	.byte $40,$40,$c0,$c0,$80,$80,$c0,$1f,$3f,$7f,$7f,$3f,$1f,$0c,$0c,$20
+	.byte $1f,$3c,$30,$00,$0a,$03,$c0,$e0,$f0,$f0,$e0,$e0,$c0,$c0,$00,$c0
+	.byte $e0,$60,$00,$0a,$19,$0d,$0d,$00,$18,$10,$10,$1f,$1f,$92,$92,$00
+	.byte $0a,$05,$80,$80,$00,$c0,$40,$40,$c0,$c0,$40,$40,$00,$9f,$cf,$ff
+	.byte $7f,$1f,$0e,$0c,$df,$60,$77,$7f,$0e,$00,$0a,$02,$20,$f0,$f8,$f0
+	.byte $e0,$c0,$0a,$03,$20,$f0,$c0,$00,$0a,$79,$03,$03,$00,$18,$10,$10
+	.byte $1f,$1f,$1c,$1c,$00,$0a,$05,$40,$40,$00,$c0,$40,$40,$c0,$c0,$80
+	.byte $80,$00,$1f,$7f,$7f,$3f,$1f,$0c,$0c,$5f,$20,$3f,$30,$00,$0a,$04
+	.byte $e0,$f0,$f0,$e0,$e0,$c0,$0a,$02,$00,$e0,$60,$00,$0a,$17,$0d,$0d
+	.byte $00,$00,$18,$10,$10,$1f,$12,$12,$1f,$1f,$00,$0a,$03,$80,$80,$00
+	.byte $00,$c0,$40,$40,$c0,$40,$40,$c0,$c0,$1f,$3f,$3f,$7f,$0a,$02,$39
+	.byte $30,$00,$0f,$1f,$38,$30,$20,$00,$00,$c0,$c0,$e0,$0a,$04,$c0,$00
+	.byte $80,$80,$d0,$f8,$6c,$24,$00,$0a,$25,$02,$07,$0f,$01,$03,$1f,$07
+	.byte $18,$22,$47,$4a,$00,$0a,$06,$80,$80,$c0,$f8,$e0,$18,$44,$22,$92
+	.byte $0f,$0f,$07,$07,$03,$01,$01,$00,$48,$4a,$45,$47,$53,$49,$21,$1f
+	.byte $80,$c8,$d8,$f8,$f8,$f0,$e0,$00,$82,$82,$da,$fa,$3a,$f2,$c4,$f8
+	.byte $00,$0a,$c7,$22,$0a,$03,$08,$48,$48,$08,$00,$0a,$07,$2a,$2a,$08
+	.byte $48,$40,$02,$22,$22,$00,$0a,$59,$03,$06,$04,$0a,$02,$06,$00,$0a
+	.byte $09,$30,$18,$08,$0a,$02,$18,$00,$0a,$04,$06,$07,$03,$07,$03,$0a
+	.byte $03,$13,$19,$0c,$00,$00,$d8,$d8,$00,$0c,$fc,$f8,$0a,$02,$20,$20
+	.byte $f8,$f8,$10,$e0,$0f,$07,$07,$0f,$0a,$02,$03,$03,$00,$01,$03,$02
+	.byte $06,$00,$0a,$02,$f0,$f8,$f8,$fc,$fc,$b8,$b8,$18,$00,$40,$50,$d8
+	.byte $10,$00,$0a,$ad,$03,$06,$04,$0a,$02,$00,$0a,$0a,$30,$18,$08,$0a
+	.byte $02,$00,$0a,$05,$06,$07,$06,$07,$03,$0a,$03,$13,$19,$00,$0a,$02
+	.byte $d8,$d8,$00,$08,$f0,$18,$f8,$f8,$20,$20,$f8,$f8,$10,$03,$0f,$07
+	.byte $0f,$0a,$02,$03,$03,$0c,$00,$03,$02,$06,$00,$0a,$02,$f8,$f0,$f8
+	.byte $fc,$fc,$b8,$b8,$18,$e0,$00,$50,$d8,$10,$00,$0a,$36,$0e,$1e,$3f
+	.byte $7f,$00,$01,$0a,$03,$0d,$1e,$3e,$00,$0a,$07,$c6,$c7,$83,$01,$81
+	.byte $c3,$ff,$ff,$7f,$ff,$0a,$03,$fe,$fc,$f4,$3e,$7e,$0a,$03,$79,$73
+	.byte $0b,$24,$66,$18,$a5,$c3,$fe,$7e,$7e,$db,$99,$e7,$5a,$3c,$00,$8c
+	.byte $8c,$44,$48,$0a,$02,$49,$51,$53,$7f,$3b,$37,$0a,$02,$36,$2e,$2c
+	.byte $01,$72,$f2,$fa,$fa,$fe,$fe,$ff,$ff,$8c,$0c,$04,$04,$00,$04,$ac
+	.byte $ae,$00,$0a,$a3,$0e,$1e,$3e,$7f,$00,$00,$01,$0a,$02,$0d,$1f,$3e
+	.byte $00,$0a,$08,$c6,$c7,$83,$01,$81,$c3,$ff,$7f,$ff,$0a,$04,$fc,$f4
+	.byte $3e,$7e,$0a,$03,$78,$73,$0b,$00,$24,$66,$18,$a5,$c3,$fe,$7e,$ff
+	.byte $db,$99,$e7,$5a,$3c,$00,$8c,$44,$48,$0a,$02,$49,$51,$53,$7f,$3b
+	.byte $37,$0a,$02,$36,$2e,$2c,$01,$72,$f2,$fa,$fa,$fe,$fe,$ff,$ff,$8c
+	.byte $0c,$04,$04,$00,$04,$ac,$ae,$00,$0a,$4f,$3c,$24,$e7,$ff,$0a,$02
+	.byte $3c,$3c,$00,$18,$18,$7e,$7e,$18,$18,$00,$0a,$18,$40,$20,$1c,$47
+	.byte $47,$1c,$20,$40,$00,$0a,$ff,$00,$0a,$1f,$0a,$00
+
+.if(NES_MAPPER <> 0)	;banked builds only
+
+	.export _tileset_bg_crossroads
+
+_tileset_bg_crossroads:	;2333 bytes (56%)
+	.byte $13,$00,$13,$17,$ff,$13,$07,$00,$13,$07,$ff,$13,$17,$00,$13,$07
+	.byte $55,$aa,$55,$aa,$55,$aa,$55,$aa,$55,$aa,$55,$aa,$55,$aa,$55,$aa
+	.byte $55,$aa,$55,$aa,$55,$aa,$55,$aa,$00,$13,$07,$55,$aa,$55,$aa,$55
+	.byte $aa,$55,$aa,$ff,$13,$07,$aa,$55,$aa,$55,$aa,$55,$aa,$55,$aa,$55
+	.byte $aa,$55,$aa,$55,$aa,$55,$ff,$13,$07,$aa,$55,$aa,$55,$aa,$55,$aa
+	.byte $55,$55,$aa,$55,$aa,$55,$aa,$55,$aa,$33,$cc,$33,$cc,$33,$cc,$33
+	.byte $cc,$00,$13,$07,$33,$cc,$33,$cc,$33,$cc,$33,$cc,$33,$cc,$33,$cc
+	.byte $33,$cc,$33,$cc,$00,$13,$07,$33,$cc,$33,$cc,$33,$cc,$33,$cc,$ff
+	.byte $13,$07,$cc,$33,$cc,$33,$cc,$33,$cc,$33,$cc,$33,$cc,$33,$cc,$33
+	.byte $cc,$33,$ff,$13,$07,$cc,$33,$cc,$33,$cc,$33,$cc,$33,$33,$cc,$33
+	.byte $cc,$33,$cc,$33,$cc,$3e,$7f,$13,$05,$3e,$3c,$42,$5a,$52,$5a,$42
+	.byte $3c,$00,$fe,$ff,$7f,$7b,$7b,$00,$13,$02,$f4,$4a,$52,$52,$00,$13
+	.byte $a3,$18,$3c,$7e,$ff,$ff,$db,$18,$18,$10,$38,$7c,$d6,$92,$10,$10
+	.byte $00,$18,$18,$db,$ff,$ff,$7e,$3c,$18,$10,$10,$92,$d6,$7c,$38,$10
+	.byte $00,$1c,$3c,$78,$ff,$ff,$78,$3c,$1c,$18,$30,$60,$fe,$60,$30,$18
+	.byte $00,$38,$3c,$1e,$ff,$ff,$1e,$3c,$38,$30,$18,$0c,$fe,$0c,$18,$30
+	.byte $00,$13,$10,$3c,$13,$02,$38,$13,$06,$30,$13,$02,$00,$30,$00,$3c
+	.byte $13,$03,$00,$13,$03,$28,$13,$02,$00,$13,$85,$18,$18,$7e,$7e,$18
+	.byte $18,$00,$00,$10,$10,$7c,$10,$10,$00,$13,$05,$38,$38,$78,$70,$00
+	.byte $13,$03,$30,$30,$60,$00,$13,$03,$3e,$3e,$00,$13,$05,$3c,$00,$13
+	.byte $08,$38,$13,$02,$00,$13,$04,$30,$30,$00,$00,$38,$7c,$7c,$7e,$13
+	.byte $02,$3e,$00,$30,$48,$30,$5c,$48,$34,$00,$3c,$7e,$13,$05,$3c,$38
+	.byte $6c,$13,$04,$38,$00,$1c,$3c,$3c,$1c,$13,$04,$18,$38,$18,$13,$04
+	.byte $00,$3c,$7e,$7e,$3e,$7c,$7e,$13,$02,$38,$6c,$0c,$38,$60,$6c,$7c
+	.byte $00,$3c,$7e,$7e,$3e,$3e,$7e,$7e,$3c,$38,$6c,$0c,$38,$0c,$6c,$38
+	.byte $00,$7e,$13,$04,$0e,$13,$02,$6c,$13,$02,$7c,$0c,$13,$02,$00,$7e
+	.byte $13,$02,$7c,$7e,$13,$02,$3c,$7c,$6c,$60,$78,$0c,$6c,$38,$00,$3c
+	.byte $7e,$7e,$7c,$7e,$13,$02,$3c,$38,$6c,$60,$78,$6c,$6c,$38,$00,$7e
+	.byte $13,$03,$0e,$13,$03,$7c,$6c,$6c,$0c,$13,$03,$00,$3c,$7e,$13,$05
+	.byte $3c,$38,$6c,$6c,$38,$6c,$6c,$38,$00,$3c,$7e,$13,$02,$3e,$7e,$7e
+	.byte $3c,$38,$6c,$6c,$3c,$0c,$6c,$38,$00,$13,$50,$3c,$7e,$7e,$1e,$3c
+	.byte $38,$13,$03,$6c,$0c,$18,$30,$00,$30,$00,$3c,$7e,$13,$05,$3e,$38
+	.byte $44,$5c,$54,$5c,$40,$3c,$00,$3e,$7f,$77,$7f,$7f,$77,$13,$02,$3c
+	.byte $66,$66,$7e,$66,$13,$02,$00,$7e,$7f,$77,$7f,$7f,$77,$7f,$7e,$7c
+	.byte $66,$66,$7c,$66,$66,$7c,$00,$3e,$7f,$77,$70,$70,$77,$7f,$3e,$3c
+	.byte $66,$60,$13,$02,$66,$3c,$00,$7c,$7e,$7f,$77,$77,$7f,$7e,$7c,$78
+	.byte $6c,$66,$13,$02,$6c,$78,$00,$7f,$7f,$70,$7f,$7f,$70,$7f,$7f,$7e
+	.byte $60,$60,$7e,$60,$60,$7e,$00,$7f,$7f,$70,$7c,$7c,$70,$13,$02,$7e
+	.byte $60,$60,$78,$60,$13,$02,$00,$3e,$7f,$77,$7f,$7f,$77,$7f,$3e,$3c
+	.byte $66,$60,$6e,$66,$66,$3c,$00,$77,$13,$02,$7f,$7f,$77,$13,$02,$66
+	.byte $13,$02,$7e,$66,$13,$02,$00,$7f,$7f,$1c,$13,$03,$7f,$7f,$7e,$18
+	.byte $13,$04,$7e,$00,$07,$13,$03,$77,$77,$7f,$3e,$06,$13,$03,$66,$66
+	.byte $3c,$00,$77,$7f,$7e,$7c,$7c,$7e,$7f,$77,$66,$6c,$78,$70,$78,$6c
+	.byte $66,$00,$70,$13,$05,$7f,$7f,$60,$13,$05,$7e,$00,$fe,$ff,$13,$03
+	.byte $e7,$13,$02,$ec,$fe,$d6,$d6,$c6,$13,$02,$00,$77,$7f,$13,$04,$77
+	.byte $77,$66,$76,$7e,$7e,$6e,$66,$66,$00,$3e,$7f,$77,$13,$03,$7f,$3e
+	.byte $3c,$66,$13,$04,$3c,$00,$7e,$7f,$77,$7f,$7e,$70,$13,$02,$7c,$66
+	.byte $66,$7c,$60,$13,$02,$00,$3e,$7f,$77,$13,$02,$7f,$7f,$3f,$3c,$66
+	.byte $13,$03,$6c,$3e,$00,$7e,$7f,$77,$7f,$7e,$7e,$7f,$77,$7c,$66,$66
+	.byte $7c,$78,$6c,$66,$00,$3e,$7f,$77,$7e,$3f,$77,$7f,$3e,$3c,$66,$60
+	.byte $3c,$06,$66,$3c,$00,$7f,$7f,$1c,$13,$05,$7e,$18,$13,$05,$00,$77
+	.byte $13,$05,$7f,$3e,$66,$13,$05,$3c,$00,$77,$13,$03,$7f,$3e,$3e,$1c
+	.byte $66,$13,$03,$3c,$3c,$18,$00,$e7,$e7,$ff,$13,$04,$7e,$c6,$c6,$d6
+	.byte $13,$02,$fe,$6c,$00,$77,$77,$7f,$3e,$3e,$7f,$77,$77,$66,$66,$3c
+	.byte $18,$3c,$66,$66,$00,$77,$13,$02,$7f,$3e,$1c,$13,$02,$66,$13,$02
+	.byte $3c,$18,$13,$02,$00,$7f,$7f,$0f,$1e,$3c,$78,$7f,$7f,$7e,$06,$0c
+	.byte $18,$30,$60,$7e,$00,$ff,$13,$07,$fc,$f8,$13,$02,$fc,$f8,$f8,$fc
+	.byte $ff,$13,$07,$3f,$1f,$1f,$3f,$1f,$13,$02,$3f,$00,$7f,$4c,$5f,$79
+	.byte $7f,$57,$5f,$ff,$13,$07,$00,$ff,$44,$ff,$99,$ff,$13,$0a,$00,$fe
+	.byte $c2,$fa,$9e,$fe,$ea,$fa,$ff,$13,$07,$00,$13,$1a,$01,$02,$04,$04
+	.byte $03,$00,$13,$0a,$80,$40,$80,$03,$04,$00,$13,$0b,$30,$48,$40,$b8
+	.byte $00,$13,$08,$06,$02,$04,$09,$0a,$0c,$ca,$00,$13,$08,$60,$40,$20
+	.byte $90,$50,$30,$53,$00,$13,$0b,$0c,$12,$02,$1d,$00,$13,$0a,$01,$02
+	.byte $01,$c0,$20,$00,$13,$0a,$80,$40,$20,$20,$c0,$00,$13,$17,$08,$13
+	.byte $07,$00,$13,$0b,$0f,$08,$13,$02,$00,$13,$0b,$f8,$08,$13,$02,$5f
+	.byte $57,$77,$5f,$5f,$57,$77,$5f,$ff,$13,$14,$91,$00,$00,$fa,$ee,$ea
+	.byte $fa,$fa,$ee,$ea,$fa,$ff,$13,$07,$00,$13,$08,$03,$04,$09,$09,$06
+	.byte $00,$13,$09,$c0,$33,$0c,$60,$18,$00,$13,$0a,$84,$49,$30,$00,$13
+	.byte $0c,$85,$02,$12,$22,$24,$18,$00,$13,$09,$29,$24,$12,$11,$0c,$02
+	.byte $04,$00,$13,$08,$94,$24,$48,$88,$30,$40,$20,$00,$13,$08,$a1,$40
+	.byte $48,$44,$24,$18,$00,$13,$09,$21,$92,$0c,$00,$13,$0c,$03,$cc,$30
+	.byte $06,$18,$00,$13,$0b,$c0,$20,$90,$90,$60,$00,$13,$0d,$ff,$00,$13
+	.byte $0a,$08,$13,$03,$0f,$00,$13,$0a,$08,$13,$03,$f8,$00,$13,$02,$5f
+	.byte $57,$7f,$79,$5f,$4c,$7f,$00,$ff,$13,$0a,$99,$ff,$44,$ff,$00,$62
+	.byte $ff,$13,$06,$fa,$ea,$fe,$9e,$fa,$c2,$fe,$00,$ff,$13,$07,$00,$13
+	.byte $9f,$ff,$13,$07,$00,$00,$91,$ff,$13,$04,$19,$d9,$80,$0e,$86,$20
+	.byte $e4,$ce,$ff,$ff,$7f,$ff,$7f,$ff,$7f,$ff,$60,$ff,$2c,$36,$31,$35
+	.byte $2b,$27,$00,$60,$08,$14,$10,$10,$02,$01,$00,$ff,$9b,$31,$40,$51
+	.byte $5a,$39,$00,$00,$0a,$11,$00,$00,$10,$08,$00,$ff,$26,$8d,$51,$55
+	.byte $d6,$ce,$00,$00,$02,$05,$01,$01,$84,$42,$c0,$e0,$80,$13,$05,$00
+	.byte $80,$00,$13,$15,$df,$dc,$c0,$03,$db,$d8,$d0,$83,$33,$ff,$7f,$ff
+	.byte $ff,$7f,$7f,$ff,$f7,$e7,$00,$66,$26,$18,$b9,$83,$9d,$ff,$13,$06
+	.byte $fb,$3b,$03,$c0,$db,$1b,$0b,$c1,$cc,$ff,$fe,$ff,$ff,$fe,$fe,$ff
+	.byte $00,$13,$13,$03,$06,$1c,$77,$00,$13,$04,$01,$03,$0f,$00,$13,$02
+	.byte $e0,$40,$20,$38,$ef,$00,$13,$03,$80,$c0,$c0,$f0,$00,$13,$4f,$3f
+	.byte $13,$02,$28,$13,$02,$aa,$6c,$00,$1b,$00,$13,$05,$ff,$13,$02,$00
+	.byte $13,$05,$de,$00,$13,$05,$ff,$13,$02,$01,$13,$02,$05,$03,$00,$ed
+	.byte $00,$13,$05,$c0,$13,$02,$40,$13,$02,$50,$60,$00,$80,$00,$13,$15
+	.byte $19,$d9,$c0,$ce,$86,$e0,$e4,$ce,$ff,$ff,$7f,$7f,$ff,$ff,$7f,$ff
+	.byte $9b,$03,$72,$60,$0e,$2c,$60,$06,$ff,$13,$07,$98,$9b,$03,$73,$61
+	.byte $07,$27,$73,$ff,$ff,$fe,$fe,$ff,$ff,$fe,$ff,$00,$13,$0f,$df,$f8
+	.byte $e0,$c0,$c0,$80,$98,$bc,$38,$67,$5f,$3f,$3f,$7f,$67,$43,$f1,$1c
+	.byte $06,$03,$03,$01,$19,$3d,$1e,$e7,$fb,$fd,$fd,$fe,$e6,$c2,$87,$cd
+	.byte $79,$03,$e0,$ff,$7f,$00,$00,$02,$86,$fc,$ff,$3f,$00,$00,$03,$0d
+	.byte $39,$c3,$1e,$f8,$e0,$00,$00,$02,$06,$3e,$f8,$e0,$00,$00,$df,$f8
+	.byte $e0,$c0,$c0,$80,$98,$bc,$38,$60,$40,$00,$13,$04,$f1,$1c,$06,$03
+	.byte $03,$01,$19,$3d,$1e,$07,$03,$01,$01,$00,$13,$62,$ff,$7f,$7f,$ff
+	.byte $ff,$7f,$ff,$33,$83,$d0,$d8,$db,$03,$c0,$dc,$df,$83,$b9,$18,$26
+	.byte $66,$00,$e7,$f7,$ff,$13,$06,$9d,$ff,$fe,$fe,$ff,$ff,$fe,$ff,$cc
+	.byte $c1,$0b,$1b,$db,$c0,$03,$3b,$fb,$00,$13,$0f,$be,$be,$9e,$46,$70
+	.byte $3f,$1f,$07,$41,$41,$61,$39,$3f,$1f,$07,$00,$7d,$7d,$79,$62,$0e
+	.byte $fc,$f8,$e0,$82,$82,$86,$9c,$fc,$f8,$e0,$00,$3c,$4e,$8f,$af,$af
+	.byte $4e,$2c,$18,$00,$3c,$7e,$5a,$5a,$3c,$18,$00,$3c,$42,$81,$a5,$a5
+	.byte $42,$24,$18,$00,$13,$07,$be,$be,$9e,$46,$40,$20,$18,$07,$00,$13
+	.byte $07,$7d,$7d,$79,$62,$02,$04,$18,$e0,$00,$13,$19,$7e,$7e,$3c,$13
+	.byte $02,$ff,$00,$00,$7e,$00,$04,$08,$10,$20,$03,$0f,$1c,$38,$33,$74
+	.byte $64,$65,$00,$08,$10,$20,$00,$13,$02,$60,$98,$f8,$78,$38,$38,$b8
+	.byte $13,$02,$00,$13,$02,$20,$13,$04,$00,$13,$2f,$01,$03,$1f,$07,$18
+	.byte $22,$47,$4a,$00,$13,$04,$02,$07,$0f,$80,$c0,$f8,$e0,$18,$44,$22
+	.byte $92,$00,$13,$06,$80,$00,$00,$03,$04,$04,$08,$08,$10,$00,$00,$03
+	.byte $07,$07,$0f,$0f,$1f,$3f,$c0,$4c,$5e,$13,$02,$4c,$21,$3f,$ff,$ff
+	.byte $f3,$13,$02,$ff,$ff,$fc,$83,$80,$13,$04,$00,$fc,$ff,$13,$06,$00
+	.byte $00,$c0,$20,$20,$10,$10,$08,$00,$00,$c0,$e0,$e0,$f0,$f0,$f8,$00
+	.byte $13,$41,$38,$64,$c3,$7e,$66,$c3,$00,$13,$05,$3c,$7e,$f4,$93,$00
+	.byte $13,$05,$04,$f2,$f0,$00,$13,$04,$38,$d8,$18,$13,$05,$00,$18,$00
+	.byte $13,$04,$18,$00,$13,$2f,$48,$4a,$45,$47,$53,$49,$21,$1f,$0f,$0f
+	.byte $07,$07,$03,$01,$01,$00,$82,$82,$da,$fa,$3a,$f2,$c4,$f8,$80,$c8
+	.byte $d8,$f8,$f8,$f0,$e0,$00,$10,$20,$20,$40,$13,$04,$1f,$3f,$3f,$7f
+	.byte $13,$04,$1e,$00,$00,$0f,$3f,$7f,$7f,$ff,$13,$04,$f8,$c7,$ca,$8a
+	.byte $00,$00,$03,$87,$e7,$f3,$f0,$f8,$ff,$13,$02,$fc,$fc,$1f,$9f,$8f
+	.byte $08,$04,$04,$82,$82,$02,$13,$02,$f8,$fc,$fc,$fe,$13,$04,$07,$3f
+	.byte $07,$0f,$ff,$1f,$0f,$7f,$07,$00,$00,$0f,$01,$01,$0f,$01,$00,$13
+	.byte $2f,$03,$07,$0e,$0c,$1c,$1d,$13,$02,$03,$04,$08,$00,$10,$00,$13
+	.byte $02,$c0,$f0,$38,$1c,$cc,$2e,$26,$a6,$00,$10,$08,$04,$00,$13,$02
+	.byte $06,$18,$13,$07,$00,$13,$03,$18,$00,$13,$12,$10,$18,$1c,$1f,$19
+	.byte $19,$1f,$27,$00,$13,$03,$06,$06,$10,$38,$08,$18,$38,$f8,$98,$98
+	.byte $f8,$e4,$00,$13,$03,$60,$60,$08,$1c,$00,$13,$04,$03,$06,$05,$00
+	.byte $13,$04,$03,$07,$07,$00,$13,$04,$80,$60,$10,$00,$13,$04,$80,$e0
+	.byte $f0,$80,$13,$02,$81,$13,$04,$ff,$13,$0f,$92,$13,$02,$12,$22,$25
+	.byte $13,$02,$f8,$13,$02,$fc,$13,$04,$4f,$13,$02,$47,$27,$13,$03,$01
+	.byte $13,$07,$ff,$13,$07,$f9,$49,$49,$48,$00,$13,$03,$ff,$13,$02,$fa
+	.byte $b2,$92,$90,$10,$fe,$f0,$f8,$ff,$f0,$e0,$fc,$e0,$80,$f0,$80,$80
+	.byte $f0,$00,$00,$e0,$00,$13,$1f,$1c,$1b,$18,$13,$05,$00,$18,$00,$13
+	.byte $04,$18,$2f,$c9,$00,$13,$05,$20,$4f,$0f,$00,$13,$04,$18,$18,$7e
+	.byte $7e,$3c,$13,$03,$00,$00,$7e,$00,$04,$08,$10,$20,$00,$13,$0f,$30
+	.byte $2f,$20,$30,$2f,$20,$18,$17,$3f,$13,$05,$1f,$1f,$0c,$f4,$04,$0c
+	.byte $f4,$04,$18,$e8,$fc,$13,$05,$f8,$f8,$09,$10,$10,$1b,$24,$42,$73
+	.byte $41,$0f,$1f,$13,$02,$3f,$7f,$13,$02,$50,$68,$84,$14,$24,$1a,$22
+	.byte $62,$f0,$f8,$fc,$13,$02,$fe,$13,$02,$00,$00,$40,$60,$20,$22,$66
+	.byte $f6,$00,$00,$40,$60,$20,$22,$66,$f6,$00,$13,$03,$24,$45,$d7,$d4
+	.byte $00,$13,$03,$24,$45,$d7,$d4,$00,$00,$04,$0c,$45,$46,$c4,$e4,$00
+	.byte $00,$04,$0c,$45,$46,$c4,$e4,$00,$13,$0f,$10,$90,$92,$b2,$fa,$ff
+	.byte $13,$02,$00,$13,$03,$48,$49,$49,$f9,$3c,$4a,$bd,$e7,$bf,$d9,$7e
+	.byte $3c,$00,$34,$62,$1a,$50,$66,$2c,$00,$13,$20,$3c,$ff,$3c,$13,$02
+	.byte $7e,$ff,$ff,$04,$08,$10,$20,$00,$3c,$00,$13,$11,$3c,$13,$04,$7e
+	.byte $ff,$ff,$04,$08,$10,$20,$00,$3c,$00,$13,$11,$13,$00
+
+.endif
+
+.endif
@@ -0,0 +1,59 @@
+
+;------------------------------------------------------------------------------;
+;             Collision probe - tile lookup fast path for hollow_nes.c         ;
+;------------------------------------------------------------------------------;
+
+; check_collision() is called 20 times per frame by the player collision code.
+; The C version (get_tile_at() + collision_properties[]) pays for two int
+; arguments on the C stack, a 16-bit multiply-by-shift and a pointer
+; dereference through cc65's runtime. This routine does the same lookup in
+; registers, in 65-66 cycles including the rts.
+;
+; The C implementation in hollow_nes.c (get_tile_at(), only compiled when
+; the compiler is not cc65) is the reference. tools/collision_test.py runs
+; this routine against it for every (x, y) and reports the cycle count.
+
+	.importzp _room_tiles		;pointer to the current room's tile map (1024 bytes)
+	.import _collision_properties	;COLLISION_* class for each of the 256 tiles
+	.importzp ptr1, tmp1
+
+	.export _collision_at
+
+.segment "CODE"
+
+;unsigned char __fastcall__ collision_at(unsigned int yx);
+;
+;in:  A = pixel x, X = pixel y
+;out: A = collision class of the tile under (x, y), X = 0
+;
+;tile offset = (y >> 3) * 32 + (x >> 3)
+;  low byte  = ((y << 2) & $e0) | (x >> 3)
+;  high byte = y >> 6
+
+_collision_at:
+
+	lsr a
+	lsr a
+	lsr a
+	sta tmp1		;tile column
+	txa
+	asl a
+	asl a
+	and #$e0
+	ora tmp1
+	tay			;Y = low byte of the tile offset
+	txa
+	rol a
+	rol a
+	rol a
+	and #$03		;A = y >> 6, high byte of the tile offset
+	clc
+	adc _room_tiles+1
+	sta ptr1+1
+	lda _room_tiles
+	sta ptr1
+	lda (ptr1),y		;tile index
+	tax
+	lda _collision_properties,x
+	ldx #0
+	rts
@@ -0,0 +1,24 @@
+// Generated by tools/dte_pack.py from dialogue.txt, do not edit
+
+#ifndef _DIALOGUE_H
+#define _DIALOGUE_H
+
+// First page of each conversation
+#define DIALOGUE_ELDERBUG 0
+#define DIALOGUE_HORNET 9
+
+#define DIALOGUE_PAGES 14
+
+// Page control codes, see dialogue_next()
+#define DLG_END_PAGE 0x00
+#define DLG_END      0x01
+#define DLG_NEWLINE  0x0a
+#define DTE_FIRST    0x80
+
+// DTE-packed text (segment DIALOGUE, bank BANK_DIALOGUE)
+extern const unsigned char dte_first[];
+extern const unsigned char dte_second[];
+extern const unsigned int dialogue_pages[DIALOGUE_PAGES];
+extern const unsigned char dialogue_text[];
+
+#endif // dialogue.h
@@ -0,0 +1,44 @@
+; Generated by tools/dte_pack.py from dialogue.txt, do not edit
+; 14 pages, 29 pairs, 469 bytes (plain text 530 bytes)
+
+	.export _dte_first,_dte_second,_dialogue_pages,_dialogue_text
+
+.segment "DIALOGUE"	;switchable bank on MMC1/MMC3, see mapper.h
+
+_dte_first:
+	.byte $45,$41,$45,$53,$45,$4f,$41,$41,$51,$49,$41,$45,$55,$2c,$45,$52
+	.byte $44,$49,$4f,$53,$45,$4f,$4f,$43,$54,$4e,$41,$48,$41
+
+_dte_second:
+	.byte $53,$20,$20,$20,$4e,$20,$52,$4e,$55,$4e,$4d,$52,$4d,$20,$2e,$45
+	.byte $41,$4d,$2e,$4f,$4d,$4c,$53,$49,$41,$41,$49,$4f,$41
+
+_dialogue_pages:
+	.word 0,11,46,73,100,131,164,202
+	.word 240,276,285,290,320,366
+
+_dialogue_text:
+	.byte $95,$41,$8d,$56,$49,$41,$4a,$87,$54,$8e,$00,$8f,$43,$45,$49,$85
+	.byte $88,$82,$53,$85,$52,$80,$54,$81,$45,$55,$0a,$50,$86,$81,$44,$86
+	.byte $20,$41,$83,$42,$4f,$41,$53,$2d,$56,$89,$90,$53,$2e,$00,$4e,$96
+	.byte $53,$81,$97,$90,$44,$82,$80,$54,$81,$88,$49,$45,$98,$0a,$55,$4c
+	.byte $54,$91,$8a,$84,$54,$8e,$2e,$2e,$00,$4f,$83,$4f,$55,$54,$52,$4f
+	.byte $83,$52,$80,$49,$44,$84,$54,$80,$0a,$44,$80,$41,$50,$86,$45,$43
+	.byte $8b,$8a,$2e,$00,$46,$4f,$52,$8a,$20,$8c,$20,$50,$4f,$52,$20,$8c
+	.byte $8d,$50,$86,$81,$41,$53,$0a,$43,$41,$56,$8b,$99,$83,$41,$42,$9a
+	.byte $58,$92,$00,$43,$96,$54,$8c,$81,$48,$41,$56,$8b,$20,$8c,$20,$47
+	.byte $52,$87,$44,$45,$0a,$8f,$89,$85,$93,$42,$20,$4e,$96,$53,$81,$97
+	.byte $90,$44,$8e,$00,$91,$41,$47,$89,$85,$88,$82,$56,$4f,$43,$82,$54
+	.byte $8a,$42,$94,$0a,$42,$55,$53,$88,$82,$53,$45,$55,$83,$93,$4e,$9b
+	.byte $83,$4c,$41,$0a,$94,$42,$9a,$58,$92,$00,$42,$94,$8d,$43,$55,$49
+	.byte $90,$44,$92,$20,$48,$81,$8c,$20,$86,$0a,$44,$4f,$84,$54,$49,$85
+	.byte $88,$82,$50,$8f,$84,$43,$48,$82,$4f,$0a,$4c,$55,$47,$86,$2e,$00
+	.byte $98,$4c,$56,$45,$5a,$20,$93,$4e,$9b,$83,$99,$85,$53,$45,$4a,$8a
+	.byte $0a,$47,$52,$87,$44,$80,$20,$43,$4f,$49,$53,$41,$83,$41,$46,$89
+	.byte $41,$4c,$2e,$01,$4b,$49,$53,$9c,$41,$48,$21,$21,$00,$48,$59,$9c
+	.byte $21,$00,$80,$53,$82,$50,$52,$4f,$4a,$45,$54,$85,$41,$89,$44,$81
+	.byte $80,$98,$0a,$94,$20,$44,$80,$84,$56,$95,$56,$91,$84,$54,$92,$00
+	.byte $53,$82,$44,$80,$45,$4a,$81,$41,$43,$4f,$4d,$50,$87,$48,$86,$20
+	.byte $4f,$0a,$44,$80,$84,$56,$95,$56,$91,$84,$54,$4f,$8d,$53,$49,$47
+	.byte $41,$0a,$99,$83,$8f,$44,$80,$20,$93,$97,$9a,$53,$21,$00,$40,$87
+	.byte $4f,$54,$48,$8b,$55,$4e,$49,$56,$8b,$53,$8e,$9b,$4d,$45,$01
@@ -14,21 +14,40 @@
 ; FT_NTSC_SUPPORT			;undefine to exclude NTSC support
 
 	.import popa
+	.import _ppu_system
 
 FT_BASE_ADR	=$0500		;page in RAM, should be $xx00
-FT_DPCM_OFF	=$c000		;sample data start address
 
 .define FT_THREAD       1	;undefine if you call sound effects in the same thread as sound update
 .define FT_PAL_SUPPORT	1  	;undefine to exclude PAL support
 .define FT_NTSC_SUPPORT	1  	;undefine to exclude NTSC support
 .define FT_SFX_ENABLE   1
-.define FT_DPCM_ENABLE  0
+.define FT_DPCM_ENABLE  1
 .define FT_SFX_STREAMS  4
 
+.if(FT_DPCM_ENABLE)
+	.import __DPCM_START__
+FT_DPCM_OFF	=__DPCM_START__	;sample data start address, DPCM memory area of the .cfg
+
+	.assert (FT_DPCM_OFF >= $c000) .and ((FT_DPCM_OFF & $3f) = 0), lderror, "DPCM area must start at $c000-$ffc0 in 64-byte steps"
+.else
+FT_DPCM_OFF	=$c000		;sample data start address
+.endif
+
 .segment "ZEROPAGE"
 
 FT_TEMP: 		.res 3
 
+.if(FT_SFX_ENABLE)
+.segment "BSS"
+
+;number of effect streams mixed per update (1..FT_SFX_STREAMS), the others
+;hold their position until the limit is raised again; sfx_init sets it to all
+
+_sfx_limit:		.res 1
+FT_SFX_LIMIT	= _sfx_limit
+.endif
+
 .segment "CODE"
 
 	.export _famitone_init,_famitone_update
@@ -36,6 +55,8 @@ FT_TEMP: 		.res 3
 .if(FT_SFX_ENABLE)
 	.export _sfx_init
 	.export _sfx_play
+	.export _sfx_limit
+	.export _sfx_stream_ptr
 .endif
 .if(FT_DPCM_ENABLE)
         .export _sample_play
@@ -236,6 +257,11 @@ FT_SFX_CH1		= FT_SFX_STRUCT_SIZE*1
 FT_SFX_CH2		= FT_SFX_STRUCT_SIZE*2
 FT_SFX_CH3		= FT_SFX_STRUCT_SIZE*3
 
+;high byte of each stream's effect pointer, 0 when the stream is idle; the C
+;side reads it (stride FT_SFX_STRUCT_SIZE) to find a free stream
+
+_sfx_stream_ptr		= FT_SFX_PTR_H
+
 
 ;aliases for the APU registers
 
@@ -302,10 +328,10 @@ FamiToneInit:
 	stx <FT_TEMP_PTR_H
 
 	.if(FT_PITCH_FIX)
-        lda $2002	; PPU_STATUS
-        and #$80	; NTSC mode bit
-        eor #$80
-        lsr
+	jsr _ppu_system		;neslib: 0 on PAL, non-zero on NTSC (only A and X change)
+	cmp #0			;flags are from its ldx #0
+	beq @pal
+	lda #64
 @pal:
 	.else
 	.if(FT_PAL_SUPPORT)
@@ -771,24 +797,34 @@ FamiToneUpdate:
 
 	.if(FT_SFX_ENABLE)
 
-	;process all sound effect streams
+	;process the sound effect streams, the first FT_SFX_LIMIT of them
 
 	.if FT_SFX_STREAMS>0
 	ldx #FT_SFX_CH0
 	jsr _FT2SfxUpdate
 	.endif
 	.if FT_SFX_STREAMS>1
+	lda FT_SFX_LIMIT
+	cmp #2
+	bcc @sfx_done
 	ldx #FT_SFX_CH1
 	jsr _FT2SfxUpdate
 	.endif
 	.if FT_SFX_STREAMS>2
+	lda FT_SFX_LIMIT
+	cmp #3
+	bcc @sfx_done
 	ldx #FT_SFX_CH2
 	jsr _FT2SfxUpdate
 	.endif
 	.if FT_SFX_STREAMS>3
+	lda FT_SFX_LIMIT
+	cmp #4
+	bcc @sfx_done
 	ldx #FT_SFX_CH3
 	jsr _FT2SfxUpdate
 	.endif
+@sfx_done:
 
 
 	;send data from the output buffer to the APU
@@ -1131,6 +1167,9 @@ FamiToneSfxInit:
 	cpx #FT_SFX_STRUCT_SIZE*FT_SFX_STREAMS
 	bne @set_channels
 
+	lda #FT_SFX_STREAMS		;mix every stream
+	sta FT_SFX_LIMIT
+
 	rts
 
 
@@ -6,6 +6,12 @@
 // https://github.com/vitimbro
 
 
+// Linker Config (cartridge board, see mapper.h)
+//#resource "hollow_nes_nrom.cfg"
+//#resource "hollow_nes_mmc1.cfg"
+//#resource "hollow_nes_mmc3.cfg"
+#define CFGFILE hollow_nes_nrom.cfg
+
 // Standard Libraries
 #include <stdlib.h>
 #include <string.h>
@@ -20,12 +26,28 @@
 #include "vrambuf.h"   // VRAM update buffer
 //#link "vrambuf.c"
 
+// Mapper and Bank Switching
+#include "mapper.h"    // Board selection, bank switching helpers
+//#link "mapper.s"
+#include "profile.h"   // NMI timing markers (NMI_PROFILE builds)
+//#link "profile.s"
+#include "input.h"     // Pad reads, NMI latch option (INPUT_NMI_LATCH builds)
+//#link "input.s"
+
+// Dialogue Text
+#include "dialogue.h"  // Generated from dialogue.txt by tools/dte_pack.py
+//#link "dialogue_data.s"
+//#link "chr_tilesets.s"
+
 
 // CHR and Nametable Data
 //#resource "game_tileset_1.chr"       // Character set (CHR) data
+//#resource "assets/chr/chr_anim.chr"  // Tile animation banks (MMC3 CHR-ROM build)
 //#link "tileset.s"
 
-// Game Nametables
+// Game Nametables (segment ROOMS, switchable bank BANK_ROOMS on MMC1)
+// All nametable headers are generated from assets/nam/*.nam by tools/build_assets.py
+#pragma rodata-name (push,"ROOMS")
 // Nametables in first floor (y = 0)
 #include "nametable_game_0_0.h"
 #include "nametable_game_1_0.h"
@@ -42,6 +64,7 @@
 #include "nametable_game_8_1.h"
 // Nametables in third floor (y = 2)
 #include "nametable_game_2_2.h"
+#pragma rodata-name (pop)
 
 // Menu Nametable
 #include "nametable_menu.h"
@@ -49,22 +72,18 @@
 // Death Nametable
 #include "nametable_death.h"
 
+// Collision Probe (assembly fast path for check_collision)
+//#link "collision.s"
+
 // FamiTone Music and Sound Data
 //#link "famitone2.s"
 void __fastcall__ famitone_update(void);
+extern unsigned char sfx_limit;  // SFX streams mixed per tick, see audio_update()
+extern unsigned char sfx_stream_ptr[];  // Non-zero while a stream plays (stride SFX_STREAM_STRIDE)
 
-// Music Tracks
-//#link "hollow_knight_theme_data.s"      // Menu song
-extern char menu_music_data[];
-
-
-// Gameplay Music 
-//#link "dirtmouth_data.s"
-extern char game_music_data[];
-
-// Gameplay Music 2 (Hornet)
-//#link "hornet_data.s"
-extern char hornet_music_data[];
+// Music Tracks (menu, Dirtmouth, Hornet) and DPCM samples, one FamiTone set made by tools/music_pack.py
+#include "music.h"
+//#link "music_data.s"
 
 
 // Sound Effects
@@ -88,6 +107,8 @@ extern char sfx_data[];
 // Tile and Nametable Constants
 #define TILE_SIZE 8                      // Size of each tile in pixels
 #define NAMETABLE_WIDTH 32               // Number of tiles per row in the nametable
+#define TILE_SHIFT 3                     // log2(TILE_SIZE), pixel to tile conversion
+#define NAMETABLE_WIDTH_SHIFT 5          // log2(NAMETABLE_WIDTH), tile row to offset conversion
 #define TILE_MASK (TILE_SIZE - 1)        // Mask for tile alignment
 #define ALIGN_TO_TILE(x) ((x) & ~TILE_MASK) // Aligns position to nearest TILE_SIZE
 
@@ -111,6 +132,9 @@ extern char sfx_data[];
 
 
 // Animation Timing Constants
+// Per-frame code steps animations with down-counters and power-of-two masks only:
+// cc65 turns / % and * on non-constant operands into slow runtime calls.
+// tools/check_hotpath.sh fails the build if one shows up in a frame-path function.
 #define ANIM_DELAY_IDLE 32               // Delay between idle frames
 #define ANIM_DELAY_RUN 5                 // Delay between run frames
 #define ANIM_DELAY_JUMP 1
@@ -120,7 +144,7 @@ extern char sfx_data[];
 #define ANIM_DELAY_SIT 32
 
 // Animation Frame Counts
-#define IDLE_ANIM_FRAMES 2               // Frames in idle animation
+#define IDLE_ANIM_FRAMES 2               // Frames in idle animation (power of two, NPCs wrap with a mask)
 #define RUN_ANIM_FRAMES 3                // Frames in run animation
 #define JUMP_ANIM_FRAMES 1
 #define FALL_ANIM_FRAMES 1 
@@ -143,15 +167,98 @@ extern char sfx_data[];
 #define STATE_DEATH 2
 
 // Nametable Parameters
-#define NUM_GAME_NAMETABLES_X_0 5            // Total game nametables
-#define NUM_GAME_NAMETABLES_X_1 8            // Total game nametables
 #define NAMETABLE_SIZE 256                   // Size of each nametable in pixels
 
+// Room Indices (one room per game nametable, named after its map x_y position)
+#define ROOM_0_0 0
+#define ROOM_1_0 1
+#define ROOM_2_0 2
+#define ROOM_3_0 3
+#define ROOM_4_0 4
+#define ROOM_2_1 5
+#define ROOM_3_1 6
+#define ROOM_4_1 7
+#define ROOM_5_1 8
+#define ROOM_6_1 9
+#define ROOM_7_1 10
+#define ROOM_8_1 11
+#define ROOM_2_2 12
+#define NUM_ROOMS 13                         // Total game rooms
+#define ROOM_NONE 0xff                       // No neighbour room on that edge
+#define ROOM_START ROOM_0_0                  // Room the game starts in
+
+// Room Nametable Codecs
+#define ROOM_CODEC_RAW 0                     // 1024 uncompressed bytes (vram_write)
+#define ROOM_CODEC_RLE 1                     // neslib RLE stream (vram_unrle)
+#if MAPPER_BANKED
+#define ROOM_CODEC ROOM_CODEC_RLE            // Room headers are packed, decoded into the room cache
+#else
+#define ROOM_CODEC ROOM_CODEC_RAW            // No WRAM to decode rooms into
+#endif
+#define ROOM_DATA_SIZE 1024                  // Decoded room: 960 tiles + 64 attribute bytes
+#define ROOM_CACHE_SLOTS 4                   // Decoded RLE rooms kept in WRAM (MMC1/MMC3)
+
+// Music Tracks (MUSIC_MENU, MUSIC_GAME, MUSIC_HORNET are song numbers from music.h)
+#define MUSIC_NONE   0xff
+
+// Main-loop audio tick (AUDIO_MAIN_LOOP, see mapper.h)
+#define AUDIO_CATCHUP_MAX 2   // Owed FamiTone ticks one audio_update() runs besides its own
+#define AUDIO_SFX_CAP     2   // SFX streams mixed on the owed ticks (all SFX_STREAMS on the own one)
+
+// Frame Tasks (deferrable per-frame work, see run_tasks())
+#define TASK_HUD       0      // Soul and lives indicator diff
+#define TASK_NPC       1      // Talk range check against the room's NPC
+#define TASK_SAVE      2      // Bench save copy into WRAM
+#define NUM_TASKS      3
+#define TASK_SLICE     1      // Tasks an on-time frame runs in turn, besides the overdue ones
+
+// Simulate/render split (see update_game())
+#define SIM_CATCHUP_MAX 2     // Most missed frames simulated after a lag; longer stalls are loads
+#define PAL_STEP_FRAMES 5     // PAL: one extra simulate step every 5 frames (50 Hz -> 60 steps/s)
+
+// Sound Effects (index in sfx_data, named after the effects in sound_effects.s)
+#define SFX_HIT        0
+#define SFX_DAMAGE     1
+#define SFX_JUMP       2
+#define SFX_NAMETABLE  3
+#define SFX_HEAL       4
+#define SFX_DIALOGUE   5
+#define SFX_DIALOGUE_1 6
+#define SFX_DIALOGUE_2 7
+#define SFX_STREAMS    4      // FT_SFX_STREAMS in famitone2.s
+#define SFX_STREAM_STRIDE 15  // FT_SFX_STRUCT_SIZE in famitone2.s
+#define SFX_FREE       0      // Priority of a stream with nothing playing
+
+// NPCs (at most one per room)
+#define NPC_NONE     0
+#define NPC_ELDERBUG 1
+#define NPC_HORNET   2
+
+// Progress Flags (player_progress, kept in the bench save)
+#define PROGRESS_MET_ELDERBUG 0x01           // Talked to Elderbug
+#define PROGRESS_MET_HORNET   0x02           // Talked to Hornet
+
+// Bench Save (battery WRAM, MMC1/MMC3 builds)
+#define SAVE_MAGIC 0x48                      // Marks a written record ('H')
+#define SAVE_SLOT_NONE 0xff                  // No valid record in either slot
+
+// Background Tilesets (pattern table $0000, one per area; CHR-RAM build)
+#define TILESET_MAIN 0                       // Dirtmouth art, also used by the menu and Hornet's room
+#define TILESET_CROSSROADS 1                 // Crossroads rooms (ROOM_x_1)
+#define NUM_TILESETS 2
+#define TILESET_NONE 0xff                    // Nothing loaded yet
+#define CHR_STREAM_BYTES 64                  // Bytes streamed per frame with rendering on (4 tiles)
+
+// Background Tile Animations (CHR bank cycling of tiles $C0-$FF, MMC3)
+#define CHR_ANIM_NONE 0                      // Tiles $C0-$FF stay still
+#define CHR_ANIM_SPIKES 1                    // Spike tiles ($D8, $E8, $E9, $F8) glint
+
 // Life and Soul Constants
 #define MAX_LIVES 3                    // Maximum number of lives
 #define MAX_SOUL 60                    // Maximum amount of soul
 #define SOUL_GAIN 10                // Soul gained per hit on enemy
 #define SOUL_COST_HEAL 30              // Soul required to heal
+#define SOUL_ANIM_DELAY 10             // Frames between soul animation steps
 
 // Define collision types
 #define COLLISION_NONE 0
@@ -198,7 +305,8 @@ extern char sfx_data[];
 // Crawlid Enemy
 #define MAX_CRAWLIDS 2
 #define CRAWLID_Y 183
-#define CRAWLID_RUN_ANIM_FRAMES 2
+#define CRAWLID_RUN_ANIM_FRAMES 2      // Must stay a power of two (frame wraps with a mask)
+#define CRAWLID_ANIM_DELAY 15
 #define CRAWLID_HP 60
 
 #define DAMAGE_AMOUNT 20
@@ -440,6 +548,37 @@ const unsigned char* const player_R_heal_seq[HEAL_ANIM_FRAMES] = { player_R_heal
 const unsigned char* const player_L_sit_seq[SIT_ANIM_FRAMES] = { player_L_sit_1, player_L_sit_2 };
 const unsigned char* const player_R_sit_seq[SIT_ANIM_FRAMES] = { player_R_sit_1, player_R_sit_2 };
 
+//----------------------------------------------------------------------------------------//
+//                               PLAYER ANIMATION TABLES                                  //
+//----------------------------------------------------------------------------------------//
+
+typedef struct {
+    const unsigned char* const* seq;   // Animation sequence
+    unsigned char delay;               // Frames between animation steps
+    unsigned char frame_count;         // Number of frames in the sequence
+} PlayerAnim;
+
+// Player animations, indexed by [PlayerState][player_facing_right]
+const PlayerAnim player_anims[][2] = {
+ //   facing left                                               facing right
+    { {player_L_idle_seq,   ANIM_DELAY_IDLE,   IDLE_ANIM_FRAMES},   {player_R_idle_seq,   ANIM_DELAY_IDLE,   IDLE_ANIM_FRAMES}   }, // STATE_IDLE
+    { {player_L_run_seq,    ANIM_DELAY_RUN,    RUN_ANIM_FRAMES},    {player_R_run_seq,    ANIM_DELAY_RUN,    RUN_ANIM_FRAMES}    }, // STATE_RUN
+    { {player_L_jump_seq,   ANIM_DELAY_JUMP,   JUMP_ANIM_FRAMES},   {player_R_jump_seq,   ANIM_DELAY_JUMP,   JUMP_ANIM_FRAMES}   }, // STATE_JUMP
+    { {player_L_fall_seq,   ANIM_DELAY_FALL,   FALL_ANIM_FRAMES},   {player_R_fall_seq,   ANIM_DELAY_FALL,   FALL_ANIM_FRAMES}   }, // STATE_FALL
+    { {player_L_attack_seq, ANIM_DELAY_ATTACK, ATTACK_ANIM_FRAMES}, {player_R_attack_seq, ANIM_DELAY_ATTACK, ATTACK_ANIM_FRAMES} }, // STATE_ATTACK
+    { {player_L_heal_seq,   ANIM_DELAY_HEAL,   HEAL_ANIM_FRAMES},   {player_R_heal_seq,   ANIM_DELAY_HEAL,   HEAL_ANIM_FRAMES}   }, // STATE_HEAL
+    { {player_L_idle_seq,   ANIM_DELAY_IDLE,   IDLE_ANIM_FRAMES},   {player_R_idle_seq,   ANIM_DELAY_IDLE,   IDLE_ANIM_FRAMES}   }, // STATE_DIALOGUE
+    { {player_L_sit_seq,    ANIM_DELAY_SIT,    SIT_ANIM_FRAMES},    {player_R_sit_seq,    ANIM_DELAY_SIT,    SIT_ANIM_FRAMES}    }, // STATE_SIT
+};
+
+// Attack animations, indexed by AttackDirection (used instead of facing in STATE_ATTACK)
+const PlayerAnim player_attack_anims[] = {
+    {player_U_attack_seq, ANIM_DELAY_ATTACK, ATTACK_ANIM_FRAMES},   // ATTACK_UP
+    {player_D_attack_seq, ANIM_DELAY_ATTACK, ATTACK_ANIM_FRAMES},   // ATTACK_DOWN
+    {player_L_attack_seq, ANIM_DELAY_ATTACK, ATTACK_ANIM_FRAMES},   // ATTACK_LEFT
+    {player_R_attack_seq, ANIM_DELAY_ATTACK, ATTACK_ANIM_FRAMES},   // ATTACK_RIGHT
+};
+
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------------------//
 
 // Elder bug Idle sequence
@@ -476,81 +615,102 @@ typedef enum {
     STATE_DEAD,     // Player is running
 } CrawlidState;
 
-// PLAYER POSITION AND MOVEMENT VARIABLES
+// Attack direction constants
+typedef enum { 
+    ATTACK_UP,    
+    ATTACK_DOWN,     
+    ATTACK_LEFT,    
+    ATTACK_RIGHT    
+} AttackDirection;
+
+
+//------------------------- Zero-Page Hot State --------------------------//
+
+// Everything the player update, collision and animation code touches every frame lives here,
+// narrowed to bytes (flags too, since neslib's bool is an int-sized enum). The gain in cycles
+// has not been measured; compare the logic column of tools/nmi_budget.lua on an NMI_PROFILE
+// build before changing this block.
+//
+// Rules for this block:
+//  - No initializers: initialized variables go to DATA, not ZEROPAGE. The startup code
+//    clears zero page, and initialize_player()/setup_game() set the non-zero values.
+//  - Keep it small; cc65's runtime, neslib and FamiTone share the same 256 bytes.
+#pragma bss-name (push,"ZEROPAGE")
 
 // Player position in pixels
 byte player_x;                  // Player X position in pixels
 byte player_y;                  // Player Y position in pixels
 
 // Player position in subpixels (for smoother movement)
-int player_x_sub = 0;     // Player X position in subpixels (1/16 pixel precision)
-int player_y_sub = 0;     // Player Y position in subpixels (1/16 pixel precision)
+signed char player_x_sub;       // Player X subpixel remainder (1/16 pixel precision, -15..15)
+signed char player_y_sub;       // Player Y subpixel remainder (1/16 pixel precision, -15..15)
 
 // Player velocity in subpixels
-int player_x_vel_sub = 0;   // Player velocity in the X direction (subpixels)
-int player_y_vel_sub = 0;   // Player velocity in the Y direction (subpixels)
-
-// Player state variables
-bool player_facing_left = false;       // Indicates if the player is facing left
-bool player_facing_right = false;      // Indicates if the player is facing right
-bool is_on_ground = false;             // Indicates if the player is on the ground
-bool can_jump = true;                  // Indicates if the player can jump
-bool has_landed = false;               // flag to track landing
-bool can_interact = false;      // Indicates if the player can interact with background element
-bool can_sit = false;
-bool can_talk = false;
-bool is_sitting = false;
-bool is_healing = false;        // True if the player is in a healing state
+signed char player_x_vel_sub;   // Player velocity in the X direction (subpixels, +-PLAYER_SPEED)
+signed char player_y_vel_sub;   // Player velocity in the Y direction (subpixels, JUMP_SPEED..MAX_FALL_SPEED)
+
+// Player state flags
+byte player_facing_left;        // Indicates if the player is facing left
+byte player_facing_right;       // Indicates if the player is facing right (indexes player_anims)
+byte is_on_ground;              // Indicates if the player is on the ground
+byte can_jump;                  // Indicates if the player can jump
+byte has_landed;                // flag to track landing
+byte can_interact;              // Indicates if the player can interact with background element
+byte can_sit;
+byte can_talk;
+byte is_sitting;
+byte is_healing;                // True if the player is in a healing state
+byte is_attacking;
+byte collided_horizontally;
+byte collided_vertically;
 
 // Jump control variables
-unsigned char jump_timer = 0;          // Timer for jump cooldown
-int jump_hold_timer = 0;               // Timer to control jump height
+unsigned char jump_timer;       // Timer for jump cooldown
+unsigned char jump_hold_timer;  // Timer to control jump height
 
 // Attack mechanics
-bool is_attacking = false;
-unsigned char attack_timer = 0;
-
+unsigned char attack_timer;
+unsigned char attack_direction; // AttackDirection
 
 // Player animation variables
-PlayerState player_state;                          // Current player state 
-unsigned char frame = 0;                             // Animation frame counter
-unsigned char current_anim_frame_count = 0;          // Number of frames in the current animation sequence
-unsigned char anim_delay_counter = 0;                // Delay counter for animation frames
-unsigned char current_anim_delay = ANIM_DELAY_IDLE;  // Current animation delay
-const unsigned char* const* current_seq;             // Pointer to the current animation sequence
-unsigned char anim_frame = 0;
+unsigned char player_state;                   // Current PlayerState
+unsigned char current_anim_frame_count;       // Number of frames in the current animation sequence
+unsigned char anim_delay_counter;             // Frames left before the next animation step
+unsigned char current_anim_delay;             // Current animation delay
+const unsigned char* const* current_seq;      // Pointer to the current animation sequence
+unsigned char anim_frame;
 
-// Frame counters for state changes
-int frames_since_last_state_change = 0;  // Frame counter
+// Frame counter for state changes (saturates at STATE_CHANGE_DELAY)
+unsigned char frames_since_last_state_change;
 
-// Elder Bug animation variables
-unsigned char elder_bug_anim_frame = 0;    // Animation frame index for Elder Bug
-unsigned char elder_bug_delay_counter = 0; // Frame delay for idle animation
+// Cooldowns and timers (frames)
+unsigned char damage_cooldown;  // Frames before spikes/enemies can hurt again
+unsigned char stun_timer;       // Timer for Crawlid stun duration
+unsigned char strike_cooldown;  // Frames before the strike can deal damage again
+unsigned char dialogue_cooldown;// Frames before dialogue can be advanced again
 
-// Hornet animation variables
-unsigned char hornet_anim_frame = 0;    // Animation frame index for Elder Bug
-unsigned char hornet_delay_counter = 0; // Frame delay for idle animation
+#pragma bss-name (pop)
 
 
-// Game state variable
-unsigned char game_state = STATE_MENU; // Start with menu
+// Strike shown in front of the player this frame (set by simulate, drawn by render)
+byte strike_active;
 
+// Lag detection for the simulate/render split
+unsigned char game_clock;            // nesclock() at the last update_game()
+byte render_skipped;                 // Last frame kept the previous OAM
+byte frame_blocked;                  // Set by code that gives up the frame on purpose (see simulate_step())
 
-// Attack direction constants
-typedef enum { 
-    ATTACK_UP,    
-    ATTACK_DOWN,     
-    ATTACK_LEFT,    
-    ATTACK_RIGHT    
-} AttackDirection;
-
-unsigned char attack_direction;
+// PAL consoles run 50 frames a second; gameplay constants are tuned per 60 Hz step
+byte is_pal;                         // ppu_system() said PAL at boot
+unsigned char pal_frame;             // Steps run since the last extra PAL step (PAL_STEP_FRAMES: one is owed)
 
-int damage_cooldown = 0;  // Initialize cooldown counter
+// NPC animation variables (only the current room's NPC is animated)
+unsigned char npc_anim_frame = 0;    // Animation frame index for the NPC
+unsigned char npc_delay_counter = 0; // Frame delay for idle animation
 
-int stun_timer = 0;         // Timer for stun duration
 
-int strike_cooldown = 0;
+// Game state variable
+unsigned char game_state = STATE_MENU; // Start with menu
 
 
 // Player Soul and Life Variables
@@ -573,14 +733,15 @@ unsigned char mask_tile_3 = TILE_MASK_FULL;
 
 
 // Soul animation properties
-int soul_x, soul_y;                 // Position of the soul animation
+unsigned char soul_x, soul_y;        // Position of the soul animation
 unsigned char soul_frame = 0;        // Current frame of the soul animation
-bool soul_active = false;       // Whether the soul animation is active
+byte soul_active = false;       // Whether the soul animation is active
 unsigned char soul_anim_counter = 0; // Counter for controlling the animation speed
 unsigned char soul_anim_delay_counter = 0;
 
 
 // Global Variables for Crawlid's Position and State
+// Keep the struct 8 bytes so &crawlids[i] compiles to a shift instead of a runtime multiply
 typedef struct {
     unsigned char x;                // X position
     unsigned char direction;        // Movement direction: 1 for right, -1 for left
@@ -588,75 +749,237 @@ typedef struct {
     unsigned char anim_delay;       // Delay counter for animation
     unsigned char hp;               // Hit points
     CrawlidState state;             // Current state: ALIVE or DEAD
-    unsigned char nametable_x;      // Associated nametable X coordinate
-    unsigned char nametable_y;      // Associated nametable Y coordinate
+    unsigned char room;             // Room the Crawlid spawns in
 } Crawlid;
 
 Crawlid crawlids[MAX_CRAWLIDS] = {
-    {120, 1, 0, 0, CRAWLID_HP, STATE_ALIVE, 1, 0},  // Crawlid 1
-    {120, 1, 0, 0, CRAWLID_HP, STATE_ALIVE, 5, 1} // Crawlid 2
+    {120, 1, 0, 0, CRAWLID_HP, STATE_ALIVE, ROOM_1_0},  // Crawlid 1
+    {120, 1, 0, 0, CRAWLID_HP, STATE_ALIVE, ROOM_5_1}   // Crawlid 2
     // Add more crawlids as needed
 };
 
 
-bool collided_horizontally = false;
-bool collided_vertically = false;
 
 unsigned char arrow_blink_timer = 0;
 
-bool collided_elderbug = false;
-bool collided_hornet = false;
+
+//------------------------- Bench Save --------------------------//
+
+// Saved at every bench. Two slots are written alternately: a reset or power cut
+// during a write leaves that slot with a bad checksum, and the other one still loads.
+typedef struct {
+    unsigned char magic;            // SAVE_MAGIC, tells a record from blank or random WRAM
+    unsigned char sequence;         // Incremented by every save, the newest valid slot wins
+    unsigned char room;             // Room of the bench
+    unsigned char x;                // Player position in front of the bench
+    unsigned char y;
+    unsigned char progress;         // PROGRESS_* flags
+    unsigned char crawlids_dead;    // Bit i set when crawlids[i] was killed
+    unsigned char checksum;         // save_checksum() of the bytes above
+} SaveRecord;
+
+unsigned char player_progress;      // PROGRESS_* flags of the current game
+
+#if MAPPER_BANKED
+// Battery-backed WRAM at $6000 (segment SAVE), never cleared by the startup code
+#pragma bss-name (push,"SAVE")
+SaveRecord save_slots[2];
+#pragma bss-name (pop)
+
+SaveRecord save_record;             // Record being built before it is copied to a slot
+byte save_pending;                  // save_record waits for save_commit()
+#endif
+
 
 //------------------------- Dialogue Variables --------------------------//
 
+// Dialogue text is compiled from dialogue.txt by tools/dte_pack.py into dialogue_data.s
+// (DTE-packed, pre-wrapped to the box) and read through dialogue_next().
+
+// Global variables for dialogue
+unsigned char current_dialogue_index = 0;
+byte is_dialogue_active = false;
+byte dialogue_last_page;                  // Page on screen ends the conversation
+
+// Text decoder state
+const unsigned char* dialogue_src;        // Next packed byte
+unsigned char dialogue_pending;           // Second character of a DTE pair, 0 if none
+
+// On MMC3 the box is drawn in nametable C (the second screen, mirroring is horizontal)
+// and shown by two scanline splits, so the room and HUD in nametable A are never
+// overwritten and closing the box needs no reload. Rows DIALOGUE_COPY_TOP..BOTTOM of
+// the room are copied there first: the IRQ lands during the split scanline, which then
+// shows the same tiles in both nametables.
+#define DIALOGUE_COPY_TOP    1             // Row above the box
+#define DIALOGUE_COPY_BOTTOM 9             // Row below the box
+#if MAPPER_IRQ
+#define NTADR_DLG(x,y) NTADR_C(x,y)
+unsigned char dialogue_row[32];           // Nametable row being copied
+#else
+#define NTADR_DLG(x,y) NTADR_A(x,y)
+#endif
+
+
+//------------------------- NPC Descriptors --------------------------//
+
 typedef struct {
-    const char* text;  // Text to display
-    int next;          // Index of the next line (-1 if end)
-} Dialogue;
-
-Dialogue dialogues[] = {
-    {"OLA, VIAJANTE.  ", 1},
-    {"RECEIO QUE SO RESTA EU  PARA DAR AS BOAS-VINDAS.", 2},
-    {"NOSSA CIDADE ESTA QUIETAULTIMAMENTE...", 3},
-    {"OS OUTROS RESIDENTES    DESAPARECERAM.", 4},
-    {"FORAM UM POR UM, PARA ASCAVERNAS ABAIXO.", 5},
-    {"COSTUMA HAVER UM GRANDE REINO SOB NOSSA CIDADE.", 6},
-    {"IMAGINO QUE VOCE  TAMBEMBUSQUE SEUS SONHOS LA   EMBAIXO.", 7},
-    {"BEM, CUIDADO. HA UM AR  DOENTIO QUE PREENCHE O  LUGAR.", 8},
-    {"TALVEZ SONHOS NAO SEJAM GRANDES COISAS AFINAL.", -1},
-  
-    {"KISAAAH!!", 9},
-    {"HYAA!", 10},
-    {"ESSE PROJETO AINDA ESTA EM DESENVOLVIMENTO.", 11},
-    {"SE DESEJA ACOMPANHAR O  DESENVOLVIMENTO, SIGA   NAS REDES SOCIAIS!", 12},
-    {"@ANOTHERUNIVERSE.HOME", -2}
+    unsigned char x;                          // X position in the room
+    unsigned char y;                          // Y position in the room
+    unsigned char width;                      // Hitbox width for talking
+    unsigned char height;                     // Hitbox height for talking
+    const unsigned char* const* idle_seq;     // Idle animation sequence
+    unsigned char anim_delay;                 // Frames between idle animation steps
+    unsigned char dialogue;                   // First dialogue line when talked to
+} NpcDesc;
+
+// Progress flag set by talking to each NPC, indexed by NPC_* constants
+const unsigned char npc_progress[] = { 0, PROGRESS_MET_ELDERBUG, PROGRESS_MET_HORNET };
+
+// Indexed by NPC_* constants
+const NpcDesc npcs[] = {
+    {0, 0, 0, 0, NULL, 1, 0},                                                                       // NPC_NONE
+    {ELDERBUG_X, ELDERBUG_Y, ELDERBUG_WIDTH, ELDERBUG_HEIGHT, elderbug_idle_seq, ANIM_DELAY_IDLE * 2, DIALOGUE_ELDERBUG}, // NPC_ELDERBUG
+    {HORNET_X, HORNET_Y, HORNET_WIDTH, HORNET_HEIGHT, hornet_idle_seq, ANIM_DELAY_IDLE, DIALOGUE_HORNET},        // NPC_HORNET
 };
 
-// Global variables for dialogue
-int current_dialogue_index = 0;
-bool is_dialogue_active = false;
 
-int dialogue_cooldown = 0; // Add a global or static cooldown variable
+//------------------------- Room Descriptors --------------------------//
+
+typedef struct {
+    const unsigned char* nametable;  // Nametable data (tiles + attributes)
+    unsigned char codec;             // ROOM_CODEC_* used by the nametable data
+    unsigned char exit_left;         // Neighbour room through the left edge
+    unsigned char exit_right;        // Neighbour room through the right edge
+    unsigned char exit_up;           // Neighbour room through the top edge
+    unsigned char exit_down;         // Neighbour room through the bottom edge
+    unsigned char music;             // MUSIC_* track played in the room
+    unsigned char npc;               // NPC_* standing in the room
+    const char* palette;             // Background palette (16 bytes)
+    unsigned char bank;              // PRG bank holding the nametable (MMC1)
+    unsigned char tileset;           // TILESET_* background art (CHR-RAM build)
+    unsigned char chr_anim;          // CHR_ANIM_* cycling of tiles $C0-$FF (MMC3)
+} RoomDesc;
+
+//------------------------- CHR Bank Animations --------------------------//
+
+typedef struct {
+    unsigned char first;             // First 1K CHR bank of the cycle
+    unsigned char frames;            // Banks in the cycle
+    unsigned char delay;             // Frames per step
+} ChrAnimDesc;
+
+// Tile animations, indexed by CHR_ANIM_* constants. The frames are extra 1K banks
+// after the 8K base tileset (banks 8 and up), see chr_anim_start() in mapper.h.
+const ChrAnimDesc chr_anims[] = {
+    {3, 0, 0},  // CHR_ANIM_NONE
+    {8, 3, 10}, // CHR_ANIM_SPIKES: banks 8-10 of assets/chr/chr_anim.chr
+};
+
+
+// Room table, indexed by ROOM_* constants
+// Tile collisions are read from the decoded room. RLE rooms are decoded into the WRAM room
+// cache, so on NROM (no WRAM) every room must stay ROOM_CODEC_RAW. The room headers are
+// generated by tools/build_assets.py in the format ROOM_CODEC picks.
+const RoomDesc rooms[NUM_ROOMS] = {
+ // nametable            codec           left       right      up         down       music         npc           palette  bank        tileset       chr_anim
+    {nametable_game_0_0, ROOM_CODEC,     ROOM_NONE, ROOM_1_0,  ROOM_NONE, ROOM_NONE, MUSIC_GAME,   NPC_ELDERBUG, PALETTE, BANK_ROOMS, TILESET_MAIN, CHR_ANIM_NONE}, // ROOM_0_0
+    {nametable_game_1_0, ROOM_CODEC,     ROOM_0_0,  ROOM_2_0,  ROOM_NONE, ROOM_NONE, MUSIC_GAME,   NPC_NONE,     PALETTE, BANK_ROOMS, TILESET_MAIN, CHR_ANIM_NONE}, // ROOM_1_0
+    {nametable_game_2_0, ROOM_CODEC,     ROOM_1_0,  ROOM_3_0,  ROOM_NONE, ROOM_2_1,  MUSIC_GAME,   NPC_NONE,     PALETTE, BANK_ROOMS, TILESET_MAIN, CHR_ANIM_SPIKES}, // ROOM_2_0
+    {nametable_game_3_0, ROOM_CODEC,     ROOM_2_0,  ROOM_4_0,  ROOM_NONE, ROOM_3_1,  MUSIC_GAME,   NPC_NONE,     PALETTE, BANK_ROOMS, TILESET_MAIN, CHR_ANIM_SPIKES}, // ROOM_3_0
+    {nametable_game_4_0, ROOM_CODEC,     ROOM_3_0,  ROOM_NONE, ROOM_NONE, ROOM_4_1,  MUSIC_GAME,   NPC_NONE,     PALETTE, BANK_ROOMS, TILESET_MAIN, CHR_ANIM_NONE}, // ROOM_4_0
+    {nametable_game_2_1, ROOM_CODEC,     ROOM_NONE, ROOM_3_1,  ROOM_2_0,  ROOM_2_2,  MUSIC_GAME,   NPC_NONE,     PALETTE, BANK_ROOMS, TILESET_CROSSROADS, CHR_ANIM_NONE}, // ROOM_2_1
+    {nametable_game_3_1, ROOM_CODEC,     ROOM_2_1,  ROOM_4_1,  ROOM_3_0,  ROOM_NONE, MUSIC_GAME,   NPC_NONE,     PALETTE, BANK_ROOMS, TILESET_CROSSROADS, CHR_ANIM_SPIKES}, // ROOM_3_1
+    {nametable_game_4_1, ROOM_CODEC,     ROOM_3_1,  ROOM_5_1,  ROOM_4_0,  ROOM_NONE, MUSIC_GAME,   NPC_NONE,     PALETTE, BANK_ROOMS, TILESET_CROSSROADS, CHR_ANIM_NONE}, // ROOM_4_1
+    {nametable_game_5_1, ROOM_CODEC,     ROOM_4_1,  ROOM_6_1,  ROOM_NONE, ROOM_NONE, MUSIC_GAME,   NPC_NONE,     PALETTE, BANK_ROOMS, TILESET_CROSSROADS, CHR_ANIM_NONE}, // ROOM_5_1
+    {nametable_game_6_1, ROOM_CODEC,     ROOM_5_1,  ROOM_7_1,  ROOM_NONE, ROOM_NONE, MUSIC_GAME,   NPC_NONE,     PALETTE, BANK_ROOMS, TILESET_CROSSROADS, CHR_ANIM_SPIKES}, // ROOM_6_1
+    {nametable_game_7_1, ROOM_CODEC,     ROOM_6_1,  ROOM_8_1,  ROOM_NONE, ROOM_NONE, MUSIC_GAME,   NPC_NONE,     PALETTE, BANK_ROOMS, TILESET_CROSSROADS, CHR_ANIM_SPIKES}, // ROOM_7_1
+    {nametable_game_8_1, ROOM_CODEC,     ROOM_7_1,  ROOM_NONE, ROOM_NONE, ROOM_NONE, MUSIC_GAME,   NPC_NONE,     PALETTE, BANK_ROOMS, TILESET_CROSSROADS, CHR_ANIM_SPIKES}, // ROOM_8_1
+    {nametable_game_2_2, ROOM_CODEC,     ROOM_NONE, ROOM_NONE, ROOM_2_1,  ROOM_NONE, MUSIC_HORNET, NPC_HORNET,   PALETTE, BANK_ROOMS, TILESET_MAIN, CHR_ANIM_SPIKES}, // ROOM_2_2
+};
+
+// Current room (zero page, read by the collision and NPC code every frame)
+#pragma bss-name (push,"ZEROPAGE")
+unsigned char current_room;              // Index into rooms[]
+const RoomDesc* current_room_desc;       // Cached pointer to rooms[current_room], set by enter_room()
+const unsigned char* room_tiles;         // Tile map probed by collisions (collision.s reads it too)
+#pragma bss-name (pop)
+
+#if MAPPER_BANKED
+// Decoded copies of recently visited RLE rooms, so walking back and forth across an
+// edge decodes each room once. room_tiles points into it for cached rooms.
+#pragma bss-name (push,"WRAM")
+unsigned char room_cache[ROOM_CACHE_SLOTS][ROOM_DATA_SIZE];
+#pragma bss-name (pop)
+
+unsigned char room_cache_room[ROOM_CACHE_SLOTS] = { ROOM_NONE, ROOM_NONE, ROOM_NONE, ROOM_NONE };  // ROOM_* in each slot
+unsigned char room_cache_age[ROOM_CACHE_SLOTS] = { 0, 1, 2, 3 };  // 0 = most recently used
+#endif
+
 
+//------------------------- Music References --------------------------//
 
-//------------------------- Nametable References --------------------------//
+// Song currently playing
+unsigned char current_music = MUSIC_NONE;
 
-// Two-dimensional array of nametables (organized by x, y)
-const unsigned char* nametables[9][3] = {
-    {nametable_game_0_0,       NULL,                NULL},           // Column 0
-    {nametable_game_1_0,       NULL,                NULL},           // Column 1
-    {nametable_game_2_0, nametable_game_2_1, nametable_game_2_2},    // Column 2
-    {nametable_game_3_0, nametable_game_3_1,        NULL},           // Column 3
-    {nametable_game_4_0, nametable_game_4_1,        NULL},           // Column 4
-    {       NULL,        nametable_game_5_1,        NULL},           // Column 5
-    {       NULL,        nametable_game_6_1,        NULL},           // Column 6
-    {       NULL,        nametable_game_7_1,        NULL},           // Column 7
-    {       NULL,        nametable_game_8_1,        NULL},           // Column 8
+#if AUDIO_MAIN_LOOP
+unsigned char audio_clock;  // nesclock() at the last audio tick
+#endif
+
+
+//------------------------- Sound Effect Streams ----------------------//
+
+// Priority of each effect (higher preempts lower), indexed by SFX_*
+const unsigned char sfx_priority[] = {
+  3,  // SFX_HIT        15 frames
+  4,  // SFX_DAMAGE     31 frames
+  1,  // SFX_JUMP        7 frames
+  2,  // SFX_NAMETABLE  57 frames
+  3,  // SFX_HEAL       31 frames
+  2,  // SFX_DIALOGUE   14 frames
+  2,  // SFX_DIALOGUE_1 14 frames
+  2,  // SFX_DIALOGUE_2  6 frames
 };
 
-// Current nametable position
-unsigned char current_nametable_x = 0;  // X index
-unsigned char current_nametable_y = 0;  // Y index
+// Priority of the effect last started on each FamiTone stream
+unsigned char sfx_stream_priority[SFX_STREAMS];
+
+
+//------------------------- Frame Tasks --------------------------//
+
+// Work that can slip a frame or two without the player noticing
+typedef struct {
+  void (*run)(void);
+  unsigned char max_wait;     // Frames it can wait for its turn before it runs anyway
+} TaskDesc;
+
+unsigned char task_next;              // Task whose turn comes next (round-robin)
+unsigned char task_wait[NUM_TASKS];   // Frames since each task last ran
+unsigned char task_clock;             // nesclock() at the last run_tasks()
+
+
+//------------------------- CHR-RAM Tilesets --------------------------//
+
+#if CHR_RAM
+// RLE-compressed pattern tables from chr_tilesets.s (segment TILESETS, bank BANK_TILESETS)
+extern const unsigned char tileset_bg_main[];
+extern const unsigned char tileset_spr[];
+#if MAPPER_BANKED
+extern const unsigned char tileset_bg_crossroads[];
+#else
+#define tileset_bg_crossroads tileset_bg_main  // No room for it in the NROM image
+#endif
+
+// Background tilesets, indexed by TILESET_* constants
+const unsigned char* const tilesets[NUM_TILESETS] = { tileset_bg_main, tileset_bg_crossroads };
+
+unsigned char chr_tileset = TILESET_NONE;   // Tileset in (or being streamed into) pattern table $0000
+const unsigned char* chr_src;               // Next RLE byte, NULL when the stream is done
+unsigned int chr_dst;                       // Next PPU address to write
+unsigned char chr_tag;                      // RLE tag byte of the current stream
+unsigned char chr_byte;                     // Last byte written, repeated by runs
+unsigned char chr_run;                      // Repeats left in the current run
+unsigned char chr_buf[CHR_STREAM_BYTES];    // Decoded bytes waiting for VRAM
+#endif
 
 
 //------------------------------------------------------------------------------------//
@@ -672,13 +995,28 @@ void setup_game();
 void setup_death();
 void initialize_player();
 
+void play_music(unsigned char track);
+void stop_music();
+void sfx_start(unsigned char sound);
+void sample_start(unsigned char sample);
+
 //------------------- Core Game Loop and State Management ---------------------//
 
 void update_menu();
 void update_game();
+void simulate_game();
+byte simulate_step();
+void render_game();
 void update_death();
 void check_game_state();
 
+//------------------- Frame Tasks ---------------------//
+
+void run_tasks();
+void task_hud();
+void task_npc();
+void task_save();
+
 //------------------- HUD and Visual Effects ---------------------//
 
 void load_hud();
@@ -702,6 +1040,17 @@ void handle_heal_input(char pad);
 void handle_interact_input(char pad);
 
 void handle_sitting();
+
+#if MAPPER_BANKED
+void save_write();
+byte save_commit();
+byte save_load();
+#else
+// NROM has no WRAM: nothing survives a reset
+#define save_write()
+#define save_commit() ((void)0)    // Only used as a statement
+#define save_load() ((void)0)      // Only used as a statement
+#endif
 void attempt_heal();
 void player_jump();
 void handle_player_strike();
@@ -709,7 +1058,7 @@ void handle_player_strike();
 //------------------- Player Movement and Physics ---------------------//
 
 void handle_player_movement();
-int handle_subpixel_movement(int *subpixel_pos, int velocity);
+signed char handle_subpixel_movement(signed char *subpixel_pos, signed char velocity);
 void apply_player_physics();
 void apply_gravity();
 void update_jump_timer();
@@ -719,8 +1068,14 @@ void stop_horizontal_movement();
 
 //------------------- Collision Detection and Handling ---------------------//
 
+#ifdef __CC65__
+// Assembly fast path (collision.s): A = pixel x, X = pixel y
+unsigned char __fastcall__ collision_at(unsigned int yx);
+#define check_collision(x, y) collision_at(((unsigned int)(byte)(y) << 8) | (byte)(x))
+#else
 unsigned char get_tile_at(unsigned char x, unsigned char y);
 unsigned char check_collision(int x, int y);
+#endif
 void handle_collisions_from_mask(unsigned char collision_mask);
 unsigned char check_player_horizontal_collision(int* new_x, int player_y);
 unsigned char check_player_vertical_collision(int player_x, int* new_y);
@@ -732,16 +1087,17 @@ void handle_corner_collision(int* new_x, int* new_y);
 
 bool check_sprite_collision(int x1, int y1, int width1, int height1, int x2, int y2, int width2, int height2);
 
-void handle_player_elderbug_collision(int player_x, int player_y);
-void handle_player_hornet_collision(int player_x, int player_y);
+void handle_player_npc_collision(int player_x, int player_y);
 
-void update_interaction_indicator(unsigned char* oam_id);
+void update_interaction_indicator();
+void draw_interaction_indicator(unsigned char* oam_id);
 
 //------------------- Dialogue System ---------------------//
 
 void handle_dialogue();
 void load_dialogue_box();
 void load_dialogue_page();
+unsigned char dialogue_next();
 void clear_dialogue_box();
 void clear_dialogue_page();
 void handle_dialogue_input(char pad);
@@ -749,34 +1105,47 @@ void update_dialogue_cooldown();
 
 //------------------- Nametable Handling ---------------------//
 
-void load_nametable(int index);
-void load_new_nametable(unsigned char new_x, unsigned char new_y);
+void enter_room(unsigned char room);
+void load_room_nametable();
+#if MAPPER_BANKED
+const unsigned char* room_cache_fetch(unsigned char room);
+#endif
+
+#if CHR_RAM
+void chr_stream_start(const unsigned char* src, unsigned int dst);
+void chr_stream_begin(unsigned char tileset);
+void chr_stream_frames(unsigned char frames);
+void chr_stream_finish();
+#else
+// CHR-ROM: the tileset is always there
+#define chr_stream_begin(tileset)
+#define chr_stream_frames(frames) wait_frames(frames)
+#define chr_stream_finish()
+#endif
+void load_new_nametable(unsigned char room);
 void check_screen_transition();
 
 //------------------- Player Animation ---------------------//
 
-void animate_player(unsigned char* oam_id, unsigned char* anim_frame);
+void update_player_animation(unsigned char* anim_frame);
 const unsigned char* const* get_animation_sequence();
 void update_animation_sequence(const unsigned char* const* new_seq, unsigned char* anim_frame);
 void update_animation_frame(unsigned char* anim_frame);
+void draw_player(unsigned char* oam_id, unsigned char anim_frame);
 void draw_current_frame(unsigned char* oam_id, unsigned char anim_frame);
 
+void update_strike();
 void draw_strike(unsigned char* oam_id);
+void update_soul_animation();
 void draw_soul_animation(unsigned char* oam_id);
 
-void animate_elder_bug(unsigned char* oam_id);
-void animate_hornet(unsigned char* oam_id);
+void update_npc_animation();
+void draw_npc(unsigned char* oam_id);
 
 //------------------- State Updates ---------------------//
 
 void update_player_animation_state();
-void set_running_state();
-void set_idle_state();
-void set_jumping_state();
-void set_falling_state();
-void set_attacking_state();
-void set_healing_state();
-void set_sitting_state();
+void set_player_state(PlayerState state);
 
 //------------------- Damage and Death Handling ---------------------//
 
@@ -786,7 +1155,8 @@ void handle_death();
 //------------------- Enemies  ---------------------//
 
 void update_crawlids_position();
-void animate_crawlids(unsigned char* oam_id);
+void update_crawlids_animation();
+void draw_crawlids(unsigned char* oam_id);
 void handle_player_crawlid_collisions(int player_x, int player_y);
 void handle_crawlid_damage(Crawlid* c);
 void handle_strike_crawlid_collisions(int strike_x, int strike_y);
@@ -809,11 +1179,107 @@ void setup_graphics() {
 
 
 void setup_audio() {
-  famitone_init(menu_music_data); // Initialize FamiTone with the menu music by default
+  bank_push(BANK_MUSIC);
+  famitone_init(music_data);      // Initialize FamiTone once with every song
+  bank_pop();
   sfx_init(sfx_data);             // Initialize sound effects
-  nmi_set_callback(famitone_update); // Set FamiTone update function to be called during NMI
+#if AUDIO_MAIN_LOOP
+  audio_clock = nesclock();
+#endif
+  nmi_set_callback(NMI_CALLBACK); // FamiTone update (and MMC3 IRQ splits) during NMI
+}
+
+
+// Start a music track, unless it is already the one playing. All songs share one
+// FamiTone set, so switching only restarts the channels (no engine reset).
+void play_music(unsigned char track) {
+  if (track == current_music) return;
+  current_music = track;
+  bank_push(BANK_MUSIC);              // Song data lives in the music bank
+  music_play(track);
+  bank_pop();
+}
+
+// Stop the music and forget the loaded track
+void stop_music() {
+  music_stop();
+  current_music = MUSIC_NONE;
+}
+
+// Play a sound effect on a free FamiTone stream, or in place of the lowest priority
+// one if all are busy; it is dropped if they all play something more important.
+// A stream is free once FamiTone reaches the end of its effect, so there is no
+// per-frame upkeep and every call costs the same fixed loop over the streams.
+void sfx_start(unsigned char sound) {
+  unsigned char i, p;
+  unsigned char pick = 0;
+  unsigned char lowest = 0xff;
+  unsigned char offset = 0;
+
+  for (i = 0; i < SFX_STREAMS; ++i) {
+    p = sfx_stream_ptr[offset] ? sfx_stream_priority[i] : SFX_FREE;
+    if (p < lowest) {
+      lowest = p;
+      pick = i;
+    }
+    offset += SFX_STREAM_STRIDE;
+  }
+  if (sfx_priority[sound] < lowest) return;
+  sfx_stream_priority[pick] = sfx_priority[sound];
+  sfx_play(sound, pick);
+}
+
+// Play a DPCM sample (SAMPLE_* from music.h) over the effects. The sample list is
+// part of the music set, so the music bank must be mapped while it is looked up.
+void sample_start(unsigned char sample) {
+  bank_push(BANK_MUSIC);
+  sample_play(sample);
+  bank_pop();
+}
+
+#if AUDIO_MAIN_LOOP
+
+// Run the FamiTone ticks owed since the last call, one per NMI. Call it right
+// after every ppu_wait_nmi(). Ticks are owed after a lag frame and after any code
+// that blocks without calling it (ppu_off() loads, the dialogue box, the HUD
+// redraw). Up to AUDIO_CATCHUP_MAX of them run before the frame's own tick, mixing
+// only AUDIO_SFX_CAP effect streams; the rest stay owed for the next calls, so a
+// long load is made up over a few frames instead of in one burst, and the music
+// keeps its tempo.
+void audio_update() {
+  unsigned char owed = nesclock() - audio_clock;
+
+  if (!owed) return;
+  if (--owed > AUDIO_CATCHUP_MAX) owed = AUDIO_CATCHUP_MAX;
+  audio_clock += owed + 1;
+  bank_push(BANK_MUSIC);
+  sfx_limit = AUDIO_SFX_CAP;
+  while (owed) {
+    famitone_update();
+    --owed;
+  }
+  sfx_limit = SFX_STREAMS;
+  famitone_update();  // This frame's tick
+  bank_pop();
+}
+
+// delay() that keeps the audio ticking
+void wait_frames(unsigned char frames) {
+  frame_blocked = true;
+  while (frames) {
+    ppu_wait_nmi();
+    audio_update();
+    --frames;
+  }
 }
 
+#else
+
+#define audio_update()
+#define wait_frames(frames) (frame_blocked = true, delay(frames))
+
+#endif
+
 
 
 // Initialize the player with starting position, speed, and state
@@ -824,20 +1290,22 @@ void initialize_player() {
     player_x = PLAYER_INIT_X;        // Set initial x-position in pixels
     player_y = PLAYER_INIT_Y;        // Set initial y-position in pixels
     
-    // Set initial positions in subpixels (multiply by SUBPIXELS)
-    player_x_sub = player_x * SUBPIXELS;  
-    player_y_sub = player_y * SUBPIXELS;  
+    // No subpixel remainder at start
+    player_x_sub = 0;
+    player_y_sub = 0;
     
     player_x_vel_sub = 0;                   // No horizontal movement at start
     player_y_vel_sub = 0;                   // No vertical movement at start
     player_facing_right = true;               // Default to facing right
-    player_state = STATE_IDLE;                // Start in the idle state
+    player_facing_left = false;
+    can_jump = true;
+    set_player_state(STATE_IDLE);             // Start in the idle state
   
     player_lives = MAX_LIVES;
     player_soul = 0;
+    player_progress = 0;
   
-    current_nametable_x = 0;
-    current_nametable_y = 0;
+    enter_room(ROOM_START);
   
     
     // initialize crawlid enemies
@@ -850,6 +1318,9 @@ void initialize_player() {
         c->hp = CRAWLID_HP;
         c->state = STATE_ALIVE;
     }
+
+    // Continue from the last bench if there is a save
+    save_load();
 }
 
 
@@ -878,7 +1349,7 @@ void update_player() {
 
 
 void handle_player_input() {
-    char pad = pad_poll(0);      
+    char pad = input_poll();      
   
     // If the player is healing, skip movement and attack inputs
     if (is_healing) return;
@@ -890,8 +1361,8 @@ void handle_player_input() {
         // Stand up if 'A' is pressed
         if (pad & PAD_A) {
             is_sitting = false;
-            set_idle_state();  // Transition back to idle
-            delay(20);
+            set_player_state(STATE_IDLE);  // Transition back to idle
+            wait_frames(20);
             return;
         }
         return;  // Skip other input if sitting
@@ -939,7 +1410,7 @@ void handle_attack_input(char pad) {
     if ((pad & PAD_B) && !is_attacking && attack_timer == 0) {
         is_attacking = true;
         attack_timer = ATTACK_COOLDOWN;  // Start cooldown
-        sfx_play(0,0);
+        sfx_start(SFX_HIT);
       
         // Set the attack direction
         if (pad & PAD_UP) {
@@ -975,9 +1446,9 @@ void handle_interact_input(char pad) {
     if (pad & PAD_UP && player_state == STATE_IDLE && can_interact) {
       
         if (can_talk){
+          player_progress |= npc_progress[current_room_desc->npc];
           player_state = STATE_DIALOGUE;
-          if (collided_elderbug) current_dialogue_index = 0;
-          if (collided_hornet) current_dialogue_index = 9;
+          current_dialogue_index = npcs[current_room_desc->npc].dialogue;
           is_dialogue_active = true;
           handle_dialogue();  // Open the dialogue box
         }
@@ -985,7 +1456,7 @@ void handle_interact_input(char pad) {
         if (can_sit){
            player_state = STATE_SIT;
            is_sitting = true;
-           sfx_play(2,2);
+           sfx_start(SFX_JUMP);
            handle_sitting();
         }
     }
@@ -1002,8 +1473,8 @@ void attempt_heal() {
         is_healing = true;              // Enter healing state
         player_soul -= SOUL_COST_HEAL;  // Deduct soul
         player_lives++;                 // Increase lives by one
-        sfx_play(4, 4);                 // Play healing sound
-        set_healing_state();            // Update player to healing state
+        sfx_start(SFX_HEAL);                 // Play healing sound
+        set_player_state(STATE_HEAL);   // Update player to healing state
         player_x_vel_sub = 0;           // Stop player movement
         player_y_vel_sub = 0;           // Stop vertical movement
     } else {
@@ -1018,6 +1489,8 @@ void attempt_heal() {
 void handle_sitting() {
     int current_lives = player_lives;
   
+    save_write();  // Record the bench before the player sits down on it
+
     player_y -= 5;
     player_state = STATE_SIT;
     player_lives = MAX_LIVES;  
@@ -1026,10 +1499,102 @@ void handle_sitting() {
       soul_x = player_x + 5;
       soul_y = player_y - 8;  // Adjust Y position to appear above the Crawlid
       soul_active = true;       // Activate soul animation
-      sfx_play(4,4);
+      sfx_start(SFX_HEAL);
+    }
+}
+
+//-----------------------------------------------------------------------//
+//                        Bench Save                                     //
+//-----------------------------------------------------------------------//
+
+#if MAPPER_BANKED
+
+// Rotate-and-add checksum of a record, seeded so that zeroed WRAM does not pass
+unsigned char save_checksum(const SaveRecord* r) {
+    const unsigned char* p = (const unsigned char*)r;
+    unsigned char sum = SAVE_MAGIC;
+    unsigned char i;
+
+    for (i = 0; i < sizeof(SaveRecord) - 1; ++i) {
+        sum = ((sum << 1) | (sum >> 7)) + p[i];
+    }
+    return sum;
+}
+
+byte save_valid(const SaveRecord* r) {
+    return r->magic == SAVE_MAGIC && r->room < NUM_ROOMS && r->checksum == save_checksum(r);
+}
+
+// Slot holding the newest valid record, or SAVE_SLOT_NONE
+unsigned char save_newest() {
+    byte valid_0 = save_valid(&save_slots[0]);
+    byte valid_1 = save_valid(&save_slots[1]);
+
+    if (valid_0 && valid_1) {
+        // Sequence numbers wrap, compare them as a signed distance
+        return (signed char)(save_slots[1].sequence - save_slots[0].sequence) > 0 ? 1 : 0;
+    }
+    if (valid_0) return 0;
+    if (valid_1) return 1;
+    return SAVE_SLOT_NONE;
+}
+
+// Record the bench the player is sitting at. Only the snapshot is taken here; the
+// checksums and the WRAM copy run later as TASK_SAVE, when its turn comes up in run_tasks().
+void save_write() {
+    unsigned char mask = 1;
+    unsigned char i;
+
+    save_record.magic = SAVE_MAGIC;
+    save_record.room = current_room;
+    save_record.x = player_x;
+    save_record.y = player_y;
+    save_record.progress = player_progress;
+    save_record.crawlids_dead = 0;
+    for (i = 0; i < MAX_CRAWLIDS; ++i) {
+        if (crawlids[i].state == STATE_DEAD) save_record.crawlids_dead |= mask;
+        mask <<= 1;
+    }
+    save_pending = true;
+}
+
+// Copy the pending record into the older slot, returns false if there was none
+byte save_commit() {
+    unsigned char newest;
+
+    if (!save_pending) return false;
+    newest = save_newest();
+    save_record.sequence = newest == SAVE_SLOT_NONE ? 0 : save_slots[newest].sequence + 1;
+    save_record.checksum = save_checksum(&save_record);
+    memcpy(&save_slots[newest == 0 ? 1 : 0], &save_record, sizeof(SaveRecord));
+    save_pending = false;
+    return true;
+}
+
+// Put the player back at the last bench, returns false if there is no valid save
+byte save_load() {
+    unsigned char slot = save_newest();
+    const SaveRecord* r;
+    unsigned char mask = 1;
+    unsigned char i;
+
+    if (slot == SAVE_SLOT_NONE) return false;
+    r = &save_slots[slot];
+
+    player_x = r->x;
+    player_y = r->y;
+    player_progress = r->progress;
+    for (i = 0; i < MAX_CRAWLIDS; ++i) {
+        if (r->crawlids_dead & mask) crawlids[i].state = STATE_DEAD;
+        mask <<= 1;
     }
+    enter_room(r->room);
+    return true;
 }
 
+#endif
+
+
 //-----------------------------------------------------------------------//
 //                        Horizontal Movement                            //
 //-----------------------------------------------------------------------//
@@ -1082,7 +1647,7 @@ void stop_horizontal_movement() {
 //---------------------------------------------------------------------//
 
 void player_jump() {
-    sfx_play(2,2);
+    sfx_start(SFX_JUMP);
     player_y_vel_sub = JUMP_SPEED;
     is_on_ground = false;
     can_jump = false;
@@ -1131,24 +1696,20 @@ void update_jump_timer() {
 
 
 // Function to handle subpixel arithmetic
-int handle_subpixel_movement(int *player_pos_sub, int player_vel_sub) {
-    int pixel_movement = 0;
+// Adds the velocity to the subpixel remainder and returns the whole pixels to move,
+// truncated toward zero so the remainder keeps the sign of the motion.
+signed char handle_subpixel_movement(signed char *player_pos_sub, signed char player_vel_sub) {
+    signed char pos = *player_pos_sub + player_vel_sub;  // |pos| < 16 + 106, fits in a byte
+    unsigned char magnitude;
 
-    // Update the subpixel position by adding the velocity (in subpixels)
-    *player_pos_sub += player_vel_sub;
-
-    // Convert subpixels to full pixels when it exceeds 16 subpixels (i.e., 1 pixel)
-    while (abs(*player_pos_sub) >= 16) {
-        if (*player_pos_sub > 0) {
-            pixel_movement++;
-            *player_pos_sub -= 16;
-        } else {
-            pixel_movement--;
-            *player_pos_sub += 16;
-        }
+    if (pos >= 0) {
+        *player_pos_sub = pos & (SUBPIXELS - 1);
+        return (unsigned char)pos >> 4;
     }
 
-    return pixel_movement;  // Return the number of pixels the player should move
+    magnitude = -pos;
+    *player_pos_sub = -(signed char)(magnitude & (SUBPIXELS - 1));
+    return -(signed char)(magnitude >> 4);
 }
 
 void handle_player_movement() {
@@ -1172,18 +1733,19 @@ void handle_player_movement() {
 //------------------------------------------------------------------------------------------//
 
 
+// The NES build probes collisions with collision_at() in collision.s; this C version and
+// check_collision() below are only compiled by other compilers, as the reference the
+// assembly must match (tools/collision_test.py checks it for every pixel).
+#ifndef __CC65__
 // Get the tile index at a specific (x, y) pixel coordinate
 // Returns the corresponding tile index from the nametable.
 unsigned char get_tile_at(unsigned char x, unsigned char y) {
     // Convert pixel coordinates to tile coordinates (8x8 tiles)
-    unsigned char tile_x = x / TILE_SIZE;
-    unsigned char tile_y = y / TILE_SIZE;
-
-    // Retrieve the current nametable based on the current coordinates
-    const unsigned char* current_nametable = nametables[current_nametable_x][current_nametable_y];
+    unsigned char tile_x = x >> TILE_SHIFT;
+    unsigned char tile_y = y >> TILE_SHIFT;
 
-    // Return the tile index from the current nametable
-    return current_nametable[tile_x + (tile_y * NAMETABLE_WIDTH)];
+    // Return the tile index from the current room's nametable
+    return room_tiles[tile_x + ((unsigned int)tile_y << NAMETABLE_WIDTH_SHIFT)];
 }
 
 // Checks the collision type at a specific (x, y) coordinate
@@ -1191,6 +1753,7 @@ unsigned char check_collision(int x, int y) {
     unsigned char tile_index = get_tile_at(x, y);
     return collision_properties[tile_index];
 }
+#endif
 
 // Check if the player's bounding box collides with solid tiles
 // Checks all corners of the player's sprite for collisions.
@@ -1405,7 +1968,7 @@ void handle_player_crawlid_collisions(int player_x, int player_y) {
         Crawlid* c = &crawlids[i];
 
         // Skip if not in the current nametable
-        if (c->nametable_x != current_nametable_x || c->nametable_y != current_nametable_y) continue;
+        if (c->room != current_room) continue;
 
         if (c->state == STATE_DEAD) continue;
 
@@ -1422,42 +1985,27 @@ void handle_strike_crawlid_collisions(int strike_x, int strike_y) {
         Crawlid* c = &crawlids[i];
       
         // Skip if not in the current nametable
-        if (c->nametable_x != current_nametable_x || c->nametable_y != current_nametable_y) continue;
+        if (c->room != current_room) continue;
 
         if (c->state == STATE_DEAD || strike_cooldown > 0) continue;
 
         if (check_sprite_collision(strike_x, strike_y, 16, 16, c->x, CRAWLID_Y, 16, 8)) {
             handle_player_strike();  // Player gains soul upon hitting
             handle_crawlid_damage(c);  // Crawlid takes damage
+            sample_start(SAMPLE_IMPACT);  // Nail connects
             strike_cooldown = STRIKE_COOLDOWN_DURATION;
         }
     }
 }
 
-void handle_player_elderbug_collision(int player_x, int player_y) {
-    // Skip if not in the current nametable
-    if (current_nametable_x != 0 || current_nametable_y != 0) return;
-    // Check if the player and Elder Bug collide
-    if (check_sprite_collision(player_x, player_y, 16, 16, ELDERBUG_X, ELDERBUG_Y, ELDERBUG_WIDTH, ELDERBUG_HEIGHT)) {
-        can_talk = true;
-        collided_elderbug = true;
-    } else {
-        can_talk = false;
-        collided_elderbug = false;
-    }
-}
+// Check if the player stands close enough to the room's NPC to talk
+void handle_player_npc_collision(int player_x, int player_y) {
+    const NpcDesc* npc = &npcs[current_room_desc->npc];
 
-void handle_player_hornet_collision(int player_x, int player_y) {
-    // Skip if not in the current nametable
-    if (current_nametable_x != 2 || current_nametable_y != 2) return;
-  
-    // Check if the player and Elder Bug collide
-    if (check_sprite_collision(player_x, player_y, 16, 16, HORNET_X, HORNET_Y, HORNET_WIDTH, HORNET_HEIGHT)) {
+    if (check_sprite_collision(player_x, player_y, 16, 16, npc->x, npc->y, npc->width, npc->height)) {
         can_talk = true;
-        collided_hornet = true;
     } else {
         can_talk = false;
-        collided_hornet = false;
     }
 }
 
@@ -1470,7 +2018,8 @@ void handle_player_hornet_collision(int player_x, int player_y) {
 void take_damage() {
     if (damage_cooldown == 0) {  // Only take damage if cooldown has elapsed
         player_lives--;
-        sfx_play(1, 1);           // Play damage sound effect
+        sfx_start(SFX_DAMAGE);           // Play damage sound effect
+        sample_start(SAMPLE_THUD);       // Low thud on the DMC
         damage_cooldown = DAMAGE_COOLDOWN;  // Reset cooldown
 
         if (player_lives > 0) {
@@ -1520,22 +2069,15 @@ void handle_crawlid_damage(Crawlid* c) {
     }
 }
 
-// Function to draw the soul animation above the enemy
-void draw_soul_animation(unsigned char* oam_id) {
+// Advance the soul animation above the enemy
+void update_soul_animation() {
     if (soul_active) {
-        
-        // Toggle between the two frames
-        unsigned char tile = (soul_frame == 0) ? 0x1b0 : 0x1b1;
-        *oam_id = oam_spr(soul_x, soul_y, tile, 0, *oam_id);
-        *oam_id = oam_spr(soul_x, soul_y + 8, tile, 0, *oam_id);
-
-        // Update animation frame using delay counter with wraparound
+        // Update animation frame when the delay counter runs out
         if (soul_anim_delay_counter == 0) {
-            soul_frame = (soul_frame + 1) % 2;  // Alternate between two frames
+            soul_frame ^= 1;  // Alternate between two frames
+            soul_anim_delay_counter = SOUL_ANIM_DELAY;
         }
-        
-        // Increment the delay counter and wrap it around after the delay threshold
-        soul_anim_delay_counter = (soul_anim_delay_counter + 1) % 10;  // Adjust to control animation speed
+        soul_anim_delay_counter--;
 
         // Optionally, deactivate after some time
         if (soul_anim_counter >= 40) {  // Adjust duration as needed
@@ -1551,6 +2093,16 @@ void draw_soul_animation(unsigned char* oam_id) {
     }
 }
 
+// Function to draw the soul animation above the enemy
+void draw_soul_animation(unsigned char* oam_id) {
+    if (soul_active) {
+        // Toggle between the two frames
+        unsigned char tile = (soul_frame == 0) ? 0x1b0 : 0x1b1;
+        *oam_id = oam_spr(soul_x, soul_y, tile, 0, *oam_id);
+        *oam_id = oam_spr(soul_x, soul_y + 8, tile, 0, *oam_id);
+    }
+}
+
 //-----------------------------------------------------------------------------//
 //                        Handle Player State                                  //
 //-----------------------------------------------------------------------------//
@@ -1558,8 +2110,10 @@ void draw_soul_animation(unsigned char* oam_id) {
 
 // STATE AND ANIMATION
 void update_player_animation_state() {
-    // Increment the frame counter
-    frames_since_last_state_change++;
+    // Increment the frame counter, saturating so it cannot wrap around
+    if (frames_since_last_state_change < STATE_CHANGE_DELAY) {
+        frames_since_last_state_change++;
+    }
 
     // Only allow state change if enough frames have passed
     if (frames_since_last_state_change < STATE_CHANGE_DELAY) {
@@ -1571,14 +2125,14 @@ void update_player_animation_state() {
         // Only change to jumping state if player is moving upwards
         if (player_y_vel_sub < 0) {
             if (player_state != STATE_JUMP) {
-                set_jumping_state();   // Player is jumping (moving upward)
+                set_player_state(STATE_JUMP);  // Player is jumping (moving upward)
                 frames_since_last_state_change = 0;  // Reset counter
             }
         } 
         // Change to falling state if player is moving downwards
         else if (player_y_vel_sub > 0) {
             if (player_state != STATE_FALL) {
-                set_falling_state();   // Player is falling (moving downward)
+                set_player_state(STATE_FALL);  // Player is falling (moving downward)
                 frames_since_last_state_change = 0;  // Reset counter
             }
         }
@@ -1588,33 +2142,33 @@ void update_player_animation_state() {
         // Change to running if player is moving horizontally
         if (player_x_vel_sub != 0) {
             if (player_state != STATE_RUN) {
-                set_running_state();  // Running if moving horizontally
+                set_player_state(STATE_RUN);  // Running if moving horizontally
                 frames_since_last_state_change = 0;  // Reset counter
             }
         } 
         // Change to idle if player is not moving horizontally
         else {
             if (player_state != STATE_IDLE) {
-                set_idle_state(); // Idle if not moving
+                set_player_state(STATE_IDLE);  // Idle if not moving
                 frames_since_last_state_change = 0;  // Reset counter
             }
         }
     }
   
     if (is_attacking) {
-        set_attacking_state();
+        set_player_state(STATE_ATTACK);
         frames_since_last_state_change = 0;  // Reset frames counter for the next state
     }
   
     // Check if player is healing
     if (is_healing) {
-        set_healing_state();
+        set_player_state(STATE_HEAL);
         frames_since_last_state_change = 0;  // Reset frames counter for the next state
     }
   
     // Check if player is sitting
     if (is_sitting) {
-        set_sitting_state();
+        set_player_state(STATE_SIT);
         frames_since_last_state_change = 0;  // Reset frames counter for the next state
     }
    
@@ -1623,64 +2177,31 @@ void update_player_animation_state() {
 
 //------------------------------- Set Player States ------------------------------------//
 
-void set_running_state() {
-    player_state = STATE_RUN;
-    current_anim_delay = ANIM_DELAY_RUN;
-    current_anim_frame_count = RUN_ANIM_FRAMES;
-}
-
-void set_idle_state() {
-    player_state = STATE_IDLE;
-    current_anim_delay = ANIM_DELAY_IDLE;
-    current_anim_frame_count = IDLE_ANIM_FRAMES;
-}
-
-void set_jumping_state() {
-    player_state = STATE_JUMP;
-    current_anim_delay = ANIM_DELAY_JUMP;
-    current_anim_frame_count = JUMP_ANIM_FRAMES;
-}
+// Switch the player state and load its animation timing from player_anims[]
+void set_player_state(PlayerState state) {
+    const PlayerAnim* anim = &player_anims[state][player_facing_right];
 
-void set_falling_state(){
-    player_state = STATE_FALL;
-    current_anim_delay = ANIM_DELAY_FALL;
-    current_anim_frame_count = FALL_ANIM_FRAMES;
-}
-
-void set_attacking_state(){
-    player_state = STATE_ATTACK;
-    current_anim_delay = ANIM_DELAY_ATTACK;
-    current_anim_frame_count = ATTACK_ANIM_FRAMES;
-}
-
-void set_healing_state(){
-    player_state = STATE_HEAL;
-    current_anim_delay = ANIM_DELAY_HEAL;
-    current_anim_frame_count = HEAL_ANIM_FRAMES;
-}
-
-void set_sitting_state(){
-    player_state = STATE_SIT;
-    current_anim_delay = ANIM_DELAY_SIT;
-    current_anim_frame_count = SIT_ANIM_FRAMES;  
+    player_state = state;
+    current_anim_delay = anim->delay;
+    current_anim_frame_count = anim->frame_count;
 }
 
 //------------------------------------------------------------------------------------------//
 //                                 PLAYER ANIMATION FUNCTIONS                               //
 //------------------------------------------------------------------------------------------//
 
-// Main function to handle player animation
-void animate_player(unsigned char* oam_id, unsigned char* anim_frame) {
+// Main function to handle player animation (no drawing, see draw_player())
+void update_player_animation(unsigned char* anim_frame) {
     const unsigned char* const* new_seq = get_animation_sequence();  // Get current animation sequence
     update_animation_sequence(new_seq, anim_frame);   // Update animation sequence and frame
     
     // Show strike at the start of the attack animation
-    if (is_attacking && *anim_frame > 1) {
-        draw_strike(oam_id);  // Draw the strike at the start of the attack animation
+    strike_active = is_attacking && *anim_frame > 1;
+    if (strike_active) {
+        update_strike();  // Hit the Crawlids in reach of the strike
     }
     
     update_animation_frame(anim_frame);  // Handle frame updates based on delay
-    draw_current_frame(oam_id, *anim_frame);  // Draw the current frame
 
     // End the attack after all animation frames have displayed
     if (is_attacking && *anim_frame == ATTACK_ANIM_FRAMES - 1) {
@@ -1697,34 +2218,10 @@ void animate_player(unsigned char* oam_id, unsigned char* anim_frame) {
 
 // Select the animation sequence based on player's state and direction
 const unsigned char* const* get_animation_sequence() {
-    if (player_state == STATE_RUN) {
-        return player_facing_right ? player_R_run_seq : player_L_run_seq;  // Running right or left
-    } 
-    else if (player_state == STATE_IDLE) {
-        return player_facing_right ? player_R_idle_seq : player_L_idle_seq;  // Idle right or left
+    if (player_state == STATE_ATTACK) {
+        return player_attack_anims[attack_direction].seq;  // Attacks follow the strike direction
     }
-    
-    else if (player_state == STATE_JUMP) {
-        return player_facing_right ? player_R_jump_seq : player_L_jump_seq;  // Jumping right or left
-    }
-    else if (player_state == STATE_FALL) {
-        return player_facing_right ? player_R_fall_seq : player_L_fall_seq;  // Falling right or left
-    }
-    else if (player_state == STATE_ATTACK) {
-        switch (attack_direction) {
-            case ATTACK_UP:    return player_U_attack_seq;
-            case ATTACK_DOWN:  return player_D_attack_seq;
-            case ATTACK_RIGHT: return player_R_attack_seq;
-            case ATTACK_LEFT:  return player_L_attack_seq;
-        }
-    }
-    else if (player_state == STATE_HEAL) {
-        return player_facing_right ? player_R_heal_seq : player_L_heal_seq;  // Healing right or left
-    }
-    else if (player_state == STATE_SIT) {
-        return player_facing_right ? player_R_sit_seq : player_L_sit_seq;  // Healing right or left
-    }
-    return current_seq;  // Default to current sequence if state is unknown
+    return player_anims[player_state][player_facing_right].seq;
 }
 
 // Update the animation sequence and reset frame if sequence changes
@@ -1738,15 +2235,26 @@ void update_animation_sequence(const unsigned char* const* new_seq, unsigned cha
 
 
 // Handle the animation frame updates based on the delay
+// anim_delay_counter counts down; a frame step happens when it reaches zero
 void update_animation_frame(unsigned char* anim_frame) {
     if (anim_delay_counter == 0) {
-        *anim_frame = (*anim_frame + 1) % current_anim_frame_count;  // Update frame with wraparound
+        if (++*anim_frame >= current_anim_frame_count) {
+            *anim_frame = 0;  // Wrap around to the first frame
+        }
+        anim_delay_counter = current_anim_delay;  // Reload delay counter
     }
-    anim_delay_counter = (anim_delay_counter + 1) % current_anim_delay;  // Update delay counter
-  
+    anim_delay_counter--;
 }
 
 
+// Draw the player, and the strike in front of it while it is active
+void draw_player(unsigned char* oam_id, unsigned char anim_frame) {
+    if (strike_active) {
+        draw_strike(oam_id);
+    }
+    draw_current_frame(oam_id, anim_frame);
+}
+
 // Draw the current frame using meta-sprites
 void draw_current_frame(unsigned char* oam_id, unsigned char anim_frame) {
     *oam_id = oam_meta_spr(player_x, player_y, *oam_id, current_seq[anim_frame]);
@@ -1754,47 +2262,41 @@ void draw_current_frame(unsigned char* oam_id, unsigned char anim_frame) {
 
 
 
-void draw_strike(unsigned char* oam_id) {
-    int strike_x = player_x;
-    int strike_y = player_y;
+// Strike position relative to the player and metasprite, indexed by AttackDirection
+const signed char strike_offset_x[] = { 0, 0, -13, 13 };
+const signed char strike_offset_y[] = { -16, 16, 0, 0 };
+const unsigned char* const strike_sprites[] = { strike_U, strike_D, strike_L, strike_R };
 
-    switch (attack_direction) {
-        case ATTACK_UP:
-            strike_y -= 16;  // Adjust Y for upward strike
-            *oam_id = oam_meta_spr(strike_x, strike_y, *oam_id, strike_U);
-            break;
-        case ATTACK_DOWN:
-            strike_y += 16;  // Adjust Y for downward strike
-            *oam_id = oam_meta_spr(strike_x, strike_y, *oam_id, strike_D);
-            break;
-        case ATTACK_RIGHT:
-            strike_x += 13;
-            *oam_id = oam_meta_spr(strike_x, strike_y, *oam_id, strike_R);
-            break;
-        case ATTACK_LEFT:
-            strike_x -= 13;
-            *oam_id = oam_meta_spr(strike_x, strike_y, *oam_id, strike_L);
-            break;
-    }
-  
-    // Check for collision with Crawlid after strike is drawn
-    handle_strike_crawlid_collisions(strike_x, strike_y);
+// Check the strike against the Crawlids
+void update_strike() {
+    handle_strike_crawlid_collisions(player_x + strike_offset_x[attack_direction],
+                                     player_y + strike_offset_y[attack_direction]);
+}
+
+void draw_strike(unsigned char* oam_id) {
+    *oam_id = oam_meta_spr(player_x + strike_offset_x[attack_direction],
+                           player_y + strike_offset_y[attack_direction],
+                           *oam_id, strike_sprites[attack_direction]);
 }
 
 //---------------------------------------------------------------------------------------//
 
-// Function to animate the Elder Bug
-void animate_elder_bug(unsigned char* oam_id) {
+// Function to animate the room's NPC (Elder Bug, Hornet)
+void update_npc_animation() {
     // Idle animation update
-    if (elder_bug_delay_counter == 0) {
-        elder_bug_anim_frame = (elder_bug_anim_frame + 1) % IDLE_ANIM_FRAMES;
+    if (npc_delay_counter == 0) {
+        npc_anim_frame = (npc_anim_frame + 1) & (IDLE_ANIM_FRAMES - 1);
+        npc_delay_counter = npcs[current_room_desc->npc].anim_delay;
     }
-    elder_bug_delay_counter = (elder_bug_delay_counter + 1) % (ANIM_DELAY_IDLE * 2);
-
-    // Draw the current Elder Bug frame in a fixed position
-    *oam_id = oam_meta_spr(ELDERBUG_X, ELDERBUG_Y, *oam_id, elderbug_idle_seq[elder_bug_anim_frame]);
+    npc_delay_counter--;
 }
 
+// Draw the current NPC frame in a fixed position
+void draw_npc(unsigned char* oam_id) {
+    const NpcDesc* npc = &npcs[current_room_desc->npc];
+
+    *oam_id = oam_meta_spr(npc->x, npc->y, *oam_id, npc->idle_seq[npc_anim_frame]);
+}
 
 // Function to update Crawlid's position across the screen
 void update_crawlids_position() {
@@ -1803,7 +2305,7 @@ void update_crawlids_position() {
         Crawlid* c = &crawlids[i];
 
         // Skip if not in the current nametable
-        if (c->nametable_x != current_nametable_x || c->nametable_y != current_nametable_y) continue;
+        if (c->room != current_room) continue;
 
         if (c->state == STATE_DEAD) continue;  // Skip dead Crawlids
 
@@ -1824,43 +2326,45 @@ void update_crawlids_position() {
     }
 }
 
-// Function to handle Crawlid's animation and display
-void animate_crawlids(unsigned char* oam_id) {
+// Function to handle Crawlid's animation
+void update_crawlids_animation() {
     unsigned char i;
-    const unsigned char* const* crawlid_seq;
+
+    // Only animate if not stunned
+    if (stun_timer > 0) return;
 
     for (i = 0; i < MAX_CRAWLIDS; i++) {
         Crawlid* c = &crawlids[i];
 
         // Skip if not in the current nametable
-        if (c->nametable_x != current_nametable_x || c->nametable_y != current_nametable_y) continue;
+        if (c->room != current_room) continue;
 
         if (c->state == STATE_DEAD) continue;  // Skip dead Crawlids
 
-        crawlid_seq = (c->direction == 1) ? crawlid_R_run_seq : crawlid_L_run_seq;
-
-        // Only animate if not stunned
-        if (stun_timer == 0) {
-            if (c->anim_delay == 0) {
-                c->anim_frame = (c->anim_frame + 1) % CRAWLID_RUN_ANIM_FRAMES;
-            }
-            c->anim_delay = (c->anim_delay + 1) % 15;
+        if (c->anim_delay == 0) {
+            c->anim_frame = (c->anim_frame + 1) & (CRAWLID_RUN_ANIM_FRAMES - 1);
+            c->anim_delay = CRAWLID_ANIM_DELAY;
         }
-
-        *oam_id = oam_meta_spr(c->x, CRAWLID_Y, *oam_id, crawlid_seq[c->anim_frame]);
+        c->anim_delay--;
     }
 }
 
-// Function to animate Hornet
-void animate_hornet(unsigned char* oam_id) {
-    // Idle animation update
-    if (hornet_delay_counter == 0) {
-        hornet_anim_frame = (hornet_anim_frame + 1) % IDLE_ANIM_FRAMES;
-    }
-    hornet_delay_counter = (hornet_delay_counter + 1) % (ANIM_DELAY_IDLE);
+// Function to display the Crawlids of the room
+void draw_crawlids(unsigned char* oam_id) {
+    unsigned char i;
+    const unsigned char* const* crawlid_seq;
+
+    for (i = 0; i < MAX_CRAWLIDS; i++) {
+        Crawlid* c = &crawlids[i];
 
-    // Draw the current Elder Bug frame in a fixed position
-    *oam_id = oam_meta_spr(HORNET_X, HORNET_Y, *oam_id, hornet_idle_seq[hornet_anim_frame]);
+        // Skip if not in the current nametable
+        if (c->room != current_room) continue;
+
+        if (c->state == STATE_DEAD) continue;  // Skip dead Crawlids
+
+        crawlid_seq = (c->direction == 1) ? crawlid_R_run_seq : crawlid_L_run_seq;
+        *oam_id = oam_meta_spr(c->x, CRAWLID_Y, *oam_id, crawlid_seq[c->anim_frame]);
+    }
 }
 
 //-----------------------------------------------------------------------------//
@@ -1872,7 +2376,7 @@ void fade_in() {
     char i;
     for (i = 0; i <= 4; ++i) {
         pal_bright(i); // Increase brightness
-        delay(FADE_TIME); // Wait for next frame
+        wait_frames(FADE_TIME); // Wait for next frame
     }
 }
 int fade_done = 0;
@@ -1881,7 +2385,11 @@ void fade_out() {
     fade_done = 0;
     for (i = 4; i >= 0; --i) {
         pal_bright(i); // Decrease brightness
-        delay(FADE_TIME); // Wait for next frame to smooth the transition
+        if (i) {
+            wait_frames(FADE_TIME); // Wait for next frame to smooth the transition
+        } else {
+            chr_stream_frames(FADE_TIME); // Screen is black: stream a pending tileset meanwhile
+        }
     }
   fade_done = 1;
 }
@@ -1889,54 +2397,217 @@ void fade_out() {
 void flash_screen() {
     char i;
     pal_bright(8);        // Set screen to maximum brightness
-    delay(FLASH_TIME);    // Brief delay for the flash
+    wait_frames(FLASH_TIME);    // Brief delay for the flash
     pal_bright(2);        // Restore to intermediate brightness
-    delay(FLASH_TIME);    // Slight delay for visual impact
+    wait_frames(FLASH_TIME);    // Slight delay for visual impact
     pal_bright(8);        // Flash again to make it more noticeable
-    delay(FLASH_TIME); 
+    wait_frames(FLASH_TIME); 
     pal_bright(2);
     for (i = 2; i <= 4; ++i) {
         pal_bright(i); // Increase brightness
-        delay(FLASH_TIME); // Wait for next frame
+        wait_frames(FLASH_TIME); // Wait for next frame
+    }
+}
+
+
+//-----------------------------------------------------------------------------//
+//                        CHR-RAM Tileset Streaming                            //
+//-----------------------------------------------------------------------------//
+
+#if CHR_RAM
+
+// Start decoding an RLE pattern table stream to a PPU address
+void chr_stream_start(const unsigned char* src, unsigned int dst) {
+    bank_push(BANK_TILESETS);
+    chr_tag = *src;
+    bank_pop();
+    chr_src = src + 1;
+    chr_dst = dst;
+    chr_run = 0;
+}
+
+// Queue a background tileset, unless the same data is already loaded
+void chr_stream_begin(unsigned char tileset) {
+    if (chr_tileset != TILESET_NONE && tilesets[tileset] == tilesets[chr_tileset]) return;
+    chr_tileset = tileset;
+    chr_stream_start(tilesets[tileset], 0x0000);
+}
+
+// Decode up to CHR_STREAM_BYTES into chr_buf, returns the number of bytes
+unsigned char chr_stream_decode() {
+    unsigned char n = 0;
+    unsigned char b;
+
+    bank_push(BANK_TILESETS);
+    while (n < CHR_STREAM_BYTES) {
+        if (chr_run) {
+            --chr_run;
+            chr_buf[n++] = chr_byte;
+        } else if (chr_src == NULL) {
+            break;
+        } else if ((b = *chr_src++) != chr_tag) {
+            chr_buf[n++] = chr_byte = b;
+        } else if ((chr_run = *chr_src++) == 0) {
+            chr_src = NULL;  // tag, 0: end of stream
+        }
     }
+    bank_pop();
+    return n;
 }
 
+// Wait some frames, streaming CHR_STREAM_BYTES per frame through the VRAM update
+// buffer. Only call it while the screen is black: tiles change under the picture.
+// fade_out() calls it for its black step only, FADE_TIME * CHR_STREAM_BYTES = 256 of
+// the 4096 bytes of a tileset; chr_stream_finish() writes the rest with the PPU off.
+void chr_stream_frames(unsigned char frames) {
+    unsigned char n;
+
+    vrambuf_clear();
+    set_vram_update(updbuf);
+    while (frames--) {
+        n = chr_stream_decode();
+        if (n) {
+            vrambuf_put(chr_dst, (const char*)chr_buf, n);
+            chr_dst += n;
+        }
+        profile_vram(updptr);
+        vrambuf_flush();
+        audio_update();
+    }
+    set_vram_update(NULL);
+}
+
+// Write whatever is left of the stream (rendering must be off)
+void chr_stream_finish() {
+    unsigned char n;
+
+    vram_adr(chr_dst);
+    while ((n = chr_stream_decode()) != 0) {
+        vram_write(chr_buf, n);
+        chr_dst += n;
+    }
+}
+
+#endif
+
 
 //-----------------------------------------------------------------------------//
 //                       Nametable Transition Logic                            //
 //-----------------------------------------------------------------------------//
 
 
-// Function to load a new nametable based on (x, y) coordinates
-void load_new_nametable(unsigned char new_x, unsigned char new_y) {
-    // Check if the target nametable exists
-    if (nametables[new_x][new_y] == NULL) {
-        return;  // No nametable to load, exit the function
+#if MAPPER_BANKED
+
+// Decode a neslib RLE stream into RAM
+void rle_unpack(unsigned char* dst, const unsigned char* src) {
+    unsigned char tag = *src++;
+    unsigned char b = 0;
+    unsigned char n;
+
+    while (1) {
+        n = *src++;
+        if (n != tag) {
+            *dst++ = b = n;
+        } else if ((n = *src++) == 0) {
+            break;  // tag, 0: end of stream
+        } else {
+            memset(dst, b, n);
+            dst += n;
+        }
+    }
+}
+
+// Return the decoded tiles of an RLE room, decoding it into the least recently
+// used slot on a miss
+const unsigned char* room_cache_fetch(unsigned char room) {
+    const RoomDesc* desc = &rooms[room];
+    unsigned char slot;
+    unsigned char i;
+
+    for (slot = 0; slot < ROOM_CACHE_SLOTS; ++slot) {
+        if (room_cache_room[slot] == room) break;
+    }
+
+    if (slot == ROOM_CACHE_SLOTS) {
+        // Miss: evict the oldest slot
+        for (slot = 0; room_cache_age[slot] != ROOM_CACHE_SLOTS - 1; ++slot);
+        bank_push(desc->bank);
+        rle_unpack(room_cache[slot], desc->nametable);
+        bank_pop();
+        room_cache_room[slot] = room;
+    }
+
+    // Mark the slot most recently used
+    for (i = 0; i < ROOM_CACHE_SLOTS; ++i) {
+        if (room_cache_age[i] < room_cache_age[slot]) ++room_cache_age[i];
     }
+    room_cache_age[slot] = 0;
 
-    sfx_play(7,7);
+    return room_cache[slot];
+}
+
+#endif
+
+// Make a room current and point the collision probe at its tiles
+void enter_room(unsigned char room) {
+    current_room = room;
+    current_room_desc = &rooms[room];
+    bank_select(current_room_desc->bank);  // Keep the room's tiles mapped for collisions
+    room_tiles = current_room_desc->nametable;
+#if MAPPER_BANKED
+    if (current_room_desc->codec == ROOM_CODEC_RLE) {
+        room_tiles = room_cache_fetch(room);  // Decoded copy in WRAM
+    }
+#endif
+
+    // Animated background tiles, switched by the NMI from now on
+    if (current_room_desc->chr_anim == CHR_ANIM_NONE) {
+        chr_anim_stop();
+    } else {
+        chr_anim_start(chr_anims[current_room_desc->chr_anim].first,
+                       chr_anims[current_room_desc->chr_anim].frames,
+                       chr_anims[current_room_desc->chr_anim].delay);
+    }
+}
+
+// Write the current room's nametable to VRAM (rendering must be off)
+void load_room_nametable() {
+    irq_split_clear();  // A new room never keeps the dialogue box splits
+    vram_adr(NAMETABLE_A);
+#if !MAPPER_BANKED
+    if (current_room_desc->codec == ROOM_CODEC_RLE) {
+        vram_unrle(current_room_desc->nametable);
+        return;
+    }
+#endif
+    vram_write(room_tiles, ROOM_DATA_SIZE);  // Raw room data, or its decoded copy in the room cache
+}
+
+// Function to load a new room and its nametable
+void load_new_nametable(unsigned char room) {
+    frame_blocked = true;
+    sfx_start(SFX_DIALOGUE_2);
   
+    // Start streaming the new area's tileset, the fade's black frames carry part of it
+    chr_stream_begin(rooms[room].tileset);
+
     // Fade out the screen
     fade_out();
     
-    // Update the current nametable indices
-    current_nametable_x = new_x;
-    current_nametable_y = new_y;
+    // Update the current room
+    enter_room(room);
 
-    // Set VRAM address to start writing nametable
+    // Write the rest of the tileset, the room's nametable and palette
     ppu_off();
-    vram_adr(NAMETABLE_A);
-    vram_write(nametables[current_nametable_x][current_nametable_y], 1024);
+    chr_stream_finish();
+    load_room_nametable();
+    pal_bg(current_room_desc->palette);
     ppu_on_all();
   
     load_hud();
   
-  
-   // Plays Hornet Music when on nametable 2_2
-   if ((current_nametable_x == 2) && (current_nametable_y == 2)) {  
-      famitone_init(hornet_music_data);
-      music_play(0);
-  }
+    // Switch music if the room has its own track (e.g. Hornet's room)
+    play_music(current_room_desc->music);
 
     // Fade in the screen
     fade_in();
@@ -1946,40 +2617,40 @@ void load_new_nametable(unsigned char new_x, unsigned char new_y) {
 void check_screen_transition() {
     // Horizontal transitions
     if (player_x <= 1) {
-        // Move to the left nametable
-        if (current_nametable_x > 0) {
+        // Move to the left room
+        if (current_room_desc->exit_left != ROOM_NONE) {
             player_x = SCREEN_RIGHT_EDGE - 1;  // Reposition player on right side
-            load_new_nametable(current_nametable_x - 1, current_nametable_y);
+            load_new_nametable(current_room_desc->exit_left);
         } else {
-            player_x = 1;  // Keep player within screen if no nametable on the left
+            player_x = 1;  // Keep player within screen if no room on the left
         }
     } else if (player_x >= SCREEN_RIGHT_EDGE) {
-        // Move to the right nametable
-        if (current_nametable_x < 10) {
+        // Move to the right room
+        if (current_room_desc->exit_right != ROOM_NONE) {
             player_x = 1;  // Reposition player on left side
-            load_new_nametable(current_nametable_x + 1, current_nametable_y);
+            load_new_nametable(current_room_desc->exit_right);
         } else {
-            player_x = SCREEN_RIGHT_EDGE;  // Keep player within screen if no nametable on the right
+            player_x = SCREEN_RIGHT_EDGE;  // Keep player within screen if no room on the right
         }
     }
 
     // Vertical transitions
     if (player_y <= 3) {
-        // Move to the upper nametable
-        if (current_nametable_y > 0) {
+        // Move to the upper room
+        if (current_room_desc->exit_up != ROOM_NONE) {
             player_y = SCREEN_DOWN_EDGE - 10;  // Reposition player at bottom
-            load_new_nametable(current_nametable_x, current_nametable_y - 1);
+            load_new_nametable(current_room_desc->exit_up);
             player_y_vel_sub = JUMP_SPEED;
         } else {
-            player_y = 1;  // Keep player within screen if no nametable above
+            player_y = 1;  // Keep player within screen if no room above
         }
     } else if (player_y >= SCREEN_DOWN_EDGE) {
-        // Move to the lower nametable
-        if (current_nametable_y < 2) {  // Adjust based on the number of vertical levels
+        // Move to the lower room
+        if (current_room_desc->exit_down != ROOM_NONE) {
             player_y = 4;  // Reposition player at top
-            load_new_nametable(current_nametable_x, current_nametable_y + 1);
+            load_new_nametable(current_room_desc->exit_down);
         } else {
-            player_y = SCREEN_DOWN_EDGE;  // Keep player within screen if no nametable below
+            player_y = SCREEN_DOWN_EDGE;  // Keep player within screen if no room below
         }
     }
 }
@@ -1992,8 +2663,8 @@ void check_screen_transition() {
 
 
 void handle_dialogue(){
-        char pad = pad_poll(0);
-        sfx_play(5,5);
+        frame_blocked = true;  // ppu_off() while the box is drawn
+        sfx_start(SFX_DIALOGUE);
 	load_dialogue_box();
         clear_dialogue_page();
   	load_dialogue_page();     
@@ -2003,77 +2674,111 @@ void load_dialogue_box() {
   
     // write text to name table
     ppu_off();
+
+#if MAPPER_IRQ
+    {
+        unsigned char row;
+        for (row = DIALOGUE_COPY_TOP; row <= DIALOGUE_COPY_BOTTOM; row++) {
+            vram_adr(NTADR_A(0, row));
+            vram_read(dialogue_row, 32);
+            vram_adr(NTADR_C(0, row));
+            vram_write(dialogue_row, 32);
+        }
+        // Attribute rows 0-2 cover tile rows 0-11
+        vram_adr(NAMETABLE_A + 0x3c0);
+        vram_read(dialogue_row, 24);
+        vram_adr(NAMETABLE_C + 0x3c0);
+        vram_write(dialogue_row, 24);
+    }
+#endif
   
-    vram_adr(NTADR_A(2,2));		// set address
+    vram_adr(NTADR_DLG(2,2));		// set address
     vram_write("\x6b", 1);	        // write bytes to video RAM
     vram_fill(0x7a, 26);
     vram_write("\x6c", 1);
   
-    vram_adr(NTADR_A(2,3));
+    vram_adr(NTADR_DLG(2,3));
     vram_write("\x6a", 1);
-    vram_adr(NTADR_A(29,3));
+    vram_adr(NTADR_DLG(29,3));
     vram_write("\x6a", 1);
   
-    vram_adr(NTADR_A(2,4));
+    vram_adr(NTADR_DLG(2,4));
     vram_write("\x6a", 1);
-    vram_adr(NTADR_A(29,4));
+    vram_adr(NTADR_DLG(29,4));
     vram_write("\x6a", 1);
     
-    vram_adr(NTADR_A(2,5));
+    vram_adr(NTADR_DLG(2,5));
     vram_write("\x6a", 1);
-    vram_adr(NTADR_A(29,5));
+    vram_adr(NTADR_DLG(29,5));
     vram_write("\x6a", 1);
   
-    vram_adr(NTADR_A(2,6));
+    vram_adr(NTADR_DLG(2,6));
     vram_write("\x6a", 1);
-    vram_adr(NTADR_A(29,6));
+    vram_adr(NTADR_DLG(29,6));
     vram_write("\x6a", 1);
   
-    vram_adr(NTADR_A(2,7));
+    vram_adr(NTADR_DLG(2,7));
     vram_write("\x6a", 1);
-    vram_adr(NTADR_A(29,7));
+    vram_adr(NTADR_DLG(29,7));
     vram_write("\x6a", 1);
   
-    vram_adr(NTADR_A(2,8));		// set address
+    vram_adr(NTADR_DLG(2,8));		// set address
     vram_write("\x7b", 1);	        // write bytes to video RAM
     vram_fill(0x7a, 26);
     vram_write("\x7c", 1);
+
+    // Nametable C from the row above the box, back to nametable A below it
+    irq_split_clear();
+    irq_split_add(DIALOGUE_COPY_TOP * 8, 0, DIALOGUE_COPY_TOP * 8, 2);
+    irq_split_add(DIALOGUE_COPY_BOTTOM * 8, 0, DIALOGUE_COPY_BOTTOM * 8, 0);
   
     ppu_on_all();
 
 }
 
 
+// Next character or control code of the page being decoded (BANK_DIALOGUE mapped)
+unsigned char dialogue_next() {
+    unsigned char c = dialogue_pending;
+
+    if (c) {
+        dialogue_pending = 0;
+        return c;
+    }
+    c = *dialogue_src++;
+    if (c >= DTE_FIRST) {
+        c -= DTE_FIRST;
+        dialogue_pending = dte_second[c];
+        return dte_first[c];
+    }
+    return c;
+}
+
 // Function to handle dialogue pages
 void load_dialogue_page() {
-    const char* text = dialogues[current_dialogue_index].text;
-    int text_length = strlen(text);
-    int line_length = 0;
+    unsigned int adr = NTADR_DLG(4, 4);  // Start of the dialogue box
+    unsigned char c;
   
-    ppu_off();
-
-    // Set VRAM address to start of dialogue box
-    vram_adr(NTADR_A(4, 4));
-
-    // Write up to the first 24 characters on the first line
-    line_length = (text_length > 24) ? 24 : text_length;
-    vram_write(text, line_length);
+    bank_push(BANK_DIALOGUE);
+    dialogue_src = dialogue_text + dialogue_pages[current_dialogue_index];
+    dialogue_pending = 0;
 
-    // If text is longer than 24 characters, move to the next line
-    if (text_length > 24) {
-        vram_adr(NTADR_A(4, 5));  // Move to the second line
-        line_length = (text_length > 48) ? 24 : (text_length - 24);
-        vram_write(text + 24, line_length);  // Write next 24 characters
-    }
+    ppu_off();
+    vram_adr(adr);
 
-    // If text is longer than 48 characters, move to the third line
-    if (text_length > 48) {
-        vram_adr(NTADR_A(4, 6));  // Move to the third line
-        line_length = text_length - 48;
-        vram_write(text + 48, line_length);  // Write remaining characters
+    // Pages are wrapped by the encoder, so just follow the line breaks
+    while ((c = dialogue_next()) != DLG_END_PAGE && c != DLG_END) {
+        if (c == DLG_NEWLINE) {
+            adr += 32;
+            vram_adr(adr);
+        } else {
+            vram_put(c);
+        }
     }
+    dialogue_last_page = (c == DLG_END);
 
     ppu_on_all();
+    bank_pop();
 }
 
 // Clear the dialogue box by writing empty spaces
@@ -2081,25 +2786,31 @@ void clear_dialogue_page() {
     // Fill page with spaces or set tiles to empty
     ppu_off();
     
-    vram_adr(NTADR_A(3, 3));
+    vram_adr(NTADR_DLG(3, 3));
     vram_fill(0x00, 25);
-    vram_adr(NTADR_A(3, 4));
+    vram_adr(NTADR_DLG(3, 4));
     vram_fill(0x00, 25);
-    vram_adr(NTADR_A(3, 5));
+    vram_adr(NTADR_DLG(3, 5));
     vram_fill(0x00, 25);
-    vram_adr(NTADR_A(3, 6));
+    vram_adr(NTADR_DLG(3, 6));
     vram_fill(0x00, 25);
   
     ppu_on_all();
     
 }
 
-// Clear the dialogue box by writing empty spaces
+// Close the dialogue box: restore the room and the HUD under it
 void clear_dialogue_box() {
+#if MAPPER_IRQ
+    irq_split_clear();  // Nametable A still holds them
+#else
     ppu_off(); // Turn off rendering to safely update VRAM
-    vram_adr(NAMETABLE_A);
-    vram_write(nametables[current_nametable_x][current_nametable_y], 1024);
+    load_room_nametable();
     ppu_on_all();
+    clear_dialogue_page();
+    load_hud();
+    update_hud();
+#endif
 }
 
 // Handling dialogue interaction 
@@ -2107,17 +2818,15 @@ void handle_dialogue_input(char pad) {
     update_dialogue_cooldown();
   
     if (dialogue_cooldown == 0 && (pad & PAD_A)) {  // Only allow input if cooldown is zero
-        if (dialogues[current_dialogue_index].next < 0) {
-            sfx_play(6,6);
+        if (dialogue_last_page) {
+            sfx_start(SFX_DIALOGUE_1);
             is_dialogue_active = false;
             player_state = STATE_IDLE;  // Return control to player
             clear_dialogue_box();
-            clear_dialogue_page();
-            load_hud();
-            update_hud();
-            delay(20);
+            wait_frames(20);
         } else {
-            sfx_play(7,7);
+            sfx_start(SFX_DIALOGUE_2);
+            frame_blocked = true;  // ppu_off() while the page is redrawn
             clear_dialogue_page();
             current_dialogue_index += 1;
             load_dialogue_page();
@@ -2135,14 +2844,17 @@ void update_dialogue_cooldown() {
 
 //----------------------------------------------------------------------------------//
 
-// Function to display the interaction indicator
-void update_interaction_indicator(unsigned char* oam_id) {
+// Function to update the interaction flag
+void update_interaction_indicator() {
     if (can_talk || can_sit) {  // Show arrow if any interaction is possible
         can_interact = true;
     } else {
         can_interact = false;
     }
-  
+}
+
+// Function to display the interaction indicator
+void draw_interaction_indicator(unsigned char* oam_id) {
     if (can_interact && !is_sitting && !is_dialogue_active) {
         // Display the up arrow sprite above the player
         *oam_id = oam_spr(player_x, player_y + ARROW_Y_OFFSET, ARROW_TILE, ARROW_ATTR, *oam_id);
@@ -2256,34 +2968,40 @@ void update_hud() {
 // Load the nametable for the menu state
 void setup_menu() {
   
-  famitone_init(menu_music_data); // Initialize menu music 
   ppu_off(); // Turn off rendering to safely update VRAM
+  chr_stream_begin(TILESET_MAIN);
+  chr_stream_finish();
+  chr_anim_stop();
   vram_adr(NAMETABLE_A);
   vram_unrle(nametable_menu);
   ppu_on_all(); // Turn rendering back on
   
-  music_play(0); // Play the menu music
+  play_music(MUSIC_MENU); // Play the menu music
 }
 
-// Load the nametable for the game state
+// Load the nametable for the game state (room chosen by initialize_player)
 void setup_game() {
   ppu_off(); // Turn off rendering to safely update VRAM
-  vram_adr(NAMETABLE_A);
-  vram_write(nametable_game_0_0, 1024);
-
+  chr_stream_begin(current_room_desc->tileset);
+  chr_stream_finish();
+  load_room_nametable();
+  pal_bg(current_room_desc->palette);
   ppu_on_all(); // Turn rendering back on
   
-  music_play(0); // Play the gameplay music
+  play_music(current_room_desc->music); // Play the gameplay music
 }
 
 // Load the nametable for the death state
 void setup_death() {
     ppu_off(); // Turn off rendering to safely update VRAM
+    chr_stream_begin(TILESET_MAIN);
+    chr_stream_finish();
+    chr_anim_stop();
     vram_adr(NAMETABLE_A);
     vram_unrle(nametable_death); // Load the death screen nametable
     oam_clear();  // Clear all sprites
     ppu_on_all(); // Turn rendering back on
-    music_stop(); // Play death or game over music
+    stop_music(); // Play death or game over music
 }
 
 
@@ -2311,17 +3029,16 @@ void update_menu() {
     oam_hide_rest(oam_id);
   
   // Wait for Start button to begin the game
-  if (pad_trigger(0) & PAD_START) {
-    sfx_play(5,5);
+  if (input_trigger() & PAD_START) {
+    sfx_start(SFX_DIALOGUE);
     fade_out(); // Fade out before changing the state
-    music_stop();                 // Stop menu music
-    delay(60);
+    stop_music();                 // Stop menu music
+    wait_frames(60);
     game_state = STATE_GAME; // Switch to game state
-    famitone_init(game_music_data); // Initialize gameplay music
-    setup_game(); // Load game nametable
+    initialize_player(); // Picks the starting room (last bench if there is a save)
+    setup_game(); // Load game nametable and start gameplay music
     load_hud();
     fade_in(); // Fade in after loading the new state
-    initialize_player();
   }
   
    // Hide unused sprites
@@ -2329,45 +3046,116 @@ void update_menu() {
   
 }
 
-// Handle the game state
+// Handle the game state: simulate one frame, then build the OAM for it. After a
+// lag frame the missed frames are simulated too, so the game keeps real-time speed,
+// and the render is skipped: the NMI shows the previous OAM once more and the cycles
+// saved pay for the extra steps. Never twice in a row, so the sprites keep moving.
+//
+// On PAL every fifth frame gets an extra step (5 frames at 50 Hz = 6 steps at 60 Hz),
+// so speeds, gravity, animation delays and cooldowns keep their NTSC values and the
+// game runs at the same wall-clock speed on both systems.
+//
+// A step that blocks (a room load, wait_frames() when standing up, the dialogue box)
+// ends the frame's steps: the frame is used up, the steps left are dropped and the
+// frame is rendered, or the NMI would keep showing the OAM from before the block.
+// A PAL extra step that did not get to run is kept for the next frame.
 void update_game() {
-  char oam_id = 0; // Reset sprite OAM ID
+  unsigned char now = nesclock();
+  unsigned char missed = now - game_clock - 1;  // Frames lost since the last update
+  unsigned char steps = 1;
+  byte blocked = false;
+
+  game_clock = now;
+
+  // A late frame (not a room load or fade, and not right after a skip): catch up
+  if (missed != 0 && missed <= SIM_CATCHUP_MAX && !render_skipped) {
+    steps += missed;
+    render_skipped = true;
+  } else {
+    render_skipped = false;
+  }
 
+  while (steps && game_state == STATE_GAME && !blocked) {
+    blocked = simulate_step();
+    if (is_pal) ++pal_frame;  // Only the steps that ran count towards the extra one
+    --steps;
+  }
+
+  // PAL extra step, under the same guard
+  if (is_pal && pal_frame >= PAL_STEP_FRAMES && game_state == STATE_GAME && !blocked) {
+    pal_frame -= PAL_STEP_FRAMES;
+    blocked = simulate_step();
+  }
+
+  if (blocked) {
+    game_clock = nesclock();  // The blocked frames are not owed
+    render_skipped = false;
+    if (pal_frame > PAL_STEP_FRAMES) pal_frame = PAL_STEP_FRAMES;  // At most one kept step
+  }
+
+  // HUD, NPC talk range and bench save, a slice per frame (only the overdue ones on a late frame)
+  run_tasks();
+
+  if (!render_skipped) render_game();
+}
+
+// Run simulate_game() once, returns true if it blocked: it waited for frames, turned
+// the PPU off (room load, dialogue box) or entered a new room. A step that is only
+// slow is not a block; the next update_game() catches it up as a lag frame.
+byte simulate_step() {
+  unsigned char room = current_room;
+
+  frame_blocked = false;
+  simulate_game();
+  return frame_blocked || current_room != room;
+}
+
+// One frame of game logic: input, physics, animation timers and collisions. Writes
+// no OAM, so it can run more than once per frame.
+void simulate_game() {
   // Update player movement and state
   update_player();
     
-  // Animate player
-  animate_player(&oam_id, &anim_frame);
+  // Animate player (and check the strike against the Crawlids)
+  update_player_animation(&anim_frame);
   
-  update_interaction_indicator(&oam_id);  // Update the interaction arrow indicator
+  update_interaction_indicator();  // Update the interaction arrow flag
   
-  // Draw soul animation if active
-  draw_soul_animation(&oam_id);
+  update_soul_animation();
   
-  // Draw Elder Bug
-  if ((current_nametable_x == 0) && (current_nametable_y == 0)) {  // Only draw if player is in nametable 1
-      animate_elder_bug(&oam_id);
-      handle_player_elderbug_collision(player_x, player_y);
+  if (current_room_desc->npc != NPC_NONE) {
+      update_npc_animation();
   }
   
-  // Draw Hornet
-  if ((current_nametable_x == 2) && (current_nametable_y == 2)) {  // Only draw if player is in nametable 1
-      animate_hornet(&oam_id);
-      handle_player_hornet_collision(player_x, player_y);
-  }
-  
-  // Update and draw Crawlid if in the correct nametable
+  // Update Crawlids in the current nametable
   update_crawlids_position();
-  animate_crawlids(&oam_id);
+  update_crawlids_animation();
   handle_player_crawlid_collisions(player_x, player_y);
   
-  update_hud();
-  
   check_screen_transition();
   
   if (strike_cooldown > 0) {
       strike_cooldown--;
   }
+}
+
+// Build the OAM from the state simulate_game() left
+void render_game() {
+  char oam_id = 0; // Reset sprite OAM ID
+
+  draw_player(&oam_id, anim_frame);
+  draw_interaction_indicator(&oam_id);  // Draw the interaction arrow indicator
+  
+  // Draw soul animation if active
+  draw_soul_animation(&oam_id);
+  
+  // Draw the room's NPC (Elder Bug, Hornet)
+  if (current_room_desc->npc != NPC_NONE) {
+      draw_npc(&oam_id);
+  }
+  
+  // Draw Crawlids in the current nametable
+  draw_crawlids(&oam_id);
 
   // Hide sprites when dead
   if (player_lives == 0) oam_hide_rest(0);
@@ -2396,10 +3184,10 @@ void update_death() {
     // Hide unused sprites
     oam_hide_rest(oam_id);
     // Wait for Start button to return to the main menu
-    if (pad_trigger(0) & PAD_START) {
-        sfx_play(5,5);
+    if (input_trigger() & PAD_START) {
+        sfx_start(SFX_DIALOGUE);
         fade_out(); // Fade out before changing the state
-        music_stop(); // Stop death music
+        stop_music(); // Stop death music
         game_state = STATE_MENU; // Switch back to menu
         setup_menu(); // Load menu nametable
         fade_in(); // Fade in after loading the menu
@@ -2410,6 +3198,60 @@ void update_death() {
 }
 
 
+//------------------------------- Frame Tasks ------------------------------------//
+
+// Indexed by TASK_* constants
+const TaskDesc tasks[NUM_TASKS] = {
+  { task_hud,  4 },   // TASK_HUD  (a changed HUD adds a ppu_off() frame)
+  { task_npc,  2 },   // TASK_NPC
+  { task_save, 8 },   // TASK_SAVE
+};
+
+// Run the deferrable tasks a slice at a time: an on-time frame gives TASK_SLICE of
+// them a turn, in round-robin order, so their cost is spread over the frames instead
+// of landing on every one. A task that has waited max_wait frames runs anyway, out of
+// turn. After a lag frame, or any blocking call, since nesclock() keeps counting, the
+// slice is empty and only those overdue tasks run, so a heavy frame sheds this work
+// instead of lagging again. The slice is counted in tasks, not cycles: their costs
+// have not been measured.
+void run_tasks() {
+  unsigned char now = nesclock();
+  unsigned char slice = TASK_SLICE;
+  unsigned char t = task_next;
+  unsigned char i;
+
+  if ((unsigned char)(now - task_clock) > 1) slice = 0;
+  task_clock = now;
+
+  for (i = 0; i < NUM_TASKS; ++i) {
+    if (task_wait[t] < 0xff) ++task_wait[t];
+    if (task_wait[t] >= tasks[t].max_wait) {
+      task_wait[t] = 0;
+      tasks[t].run();
+    } else if (slice) {
+      --slice;
+      task_wait[t] = 0;
+      tasks[t].run();
+      task_next = t + 1 == NUM_TASKS ? 0 : t + 1;
+    }
+    if (++t == NUM_TASKS) t = 0;
+  }
+}
+
+void task_hud() {
+  update_hud();
+}
+
+void task_npc() {
+  if (current_room_desc->npc == NPC_NONE) return;
+  handle_player_npc_collision(player_x, player_y);
+}
+
+void task_save() {
+  save_commit();
+}
+
+
 //------------------------------- Check State ------------------------------------//
 
 // Check the current game state and update accordingly
@@ -2432,11 +3274,20 @@ void check_game_state() {
 
 // Main function
 void main(void) {
+  mapper_init(); // Put the cartridge mapper in a known state
+  is_pal = !ppu_system(); // 50 Hz console: update_game() adds the missing steps
+
+#if CHR_RAM
+  // CHR-RAM starts empty: load the shared sprite tiles (rendering is still off)
+  chr_stream_start(tileset_spr, 0x1000);
+  chr_stream_finish();
+#endif
+
   // Setup graphics and load the initial nametable for the menu
   setup_graphics();
   setup_audio();
   pal_bright(0);
-  delay(60);
+  wait_frames(60);
   setup_menu(); // Load menu screen initially
   fade_in(); // Fade in after loading the new state
   
@@ -2444,8 +3295,11 @@ void main(void) {
 
   // Game loop
   while (1) {
+    profile_mark(PROFILE_LOGIC);
     check_game_state(); // Check and update based on the game state
+    profile_mark(PROFILE_IDLE);
     ppu_wait_nmi();     // Wait for the next NMI (synchronizing game logic with V-blank)
-    nmi_set_callback(famitone_update);    
+    audio_update();     // FamiTone tick, when it runs outside the NMI
+    nmi_set_callback(NMI_CALLBACK);
   }
 }
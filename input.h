@@ -0,0 +1,43 @@
+
+#ifndef _INPUT_H
+#define _INPUT_H
+
+//------------------------------------------------------------------------------//
+//                          Controller Input (pad 1)                            //
+//------------------------------------------------------------------------------//
+
+// The game reads the controller through input_poll() (buttons held) and
+// input_trigger() (buttons newly pressed), never pad_poll() directly.
+//
+// By default they are neslib's pad_poll(0) and pad_trigger(0), read at the
+// start of the game logic. INPUT_NMI_LATCH reads the pad in the NMI instead
+// (input.s), at the same point of every frame, and keeps each press until the
+// logic takes it: a tap made while the logic is blocked (wait_frames(), a
+// ppu_off() room load, a lag frame) still reaches the next logic frame instead
+// of being missed. tools/input_latency.lua measures both builds. Must match
+// NES_INPUT_LATCH in mapper.inc.
+#ifndef INPUT_NMI_LATCH
+#define INPUT_NMI_LATCH 0
+#endif
+
+#if INPUT_NMI_LATCH
+
+extern unsigned char input_held;  // Buttons down at the last NMI (PAD_* bits)
+
+// Buttons pressed since the last call, each press returned once
+unsigned char __fastcall__ input_trigger(void);
+
+// NMI callback: reads the pad, then runs mapper_nmi_update
+void __fastcall__ input_nmi_update(void);
+
+// Held buttons, plus any tap that went down and up again since the last call
+#define input_poll() (input_held | input_trigger())
+
+#else
+
+#define input_poll()    pad_poll(0)
+#define input_trigger() pad_trigger(0)
+
+#endif
+
+#endif // input.h
@@ -0,0 +1,103 @@
+
+;------------------------------------------------------------------------------;
+;              Controller latch read in the NMI (INPUT_NMI_LATCH)              ;
+;------------------------------------------------------------------------------;
+
+; NMI callback of the INPUT_NMI_LATCH build, see input.h. Reads pad 1 right
+; after neslib's PPU work, before the audio tick, and collects the presses in
+; input_pressed until the game logic takes them with input_trigger().
+;
+; The read does not call neslib's pad_poll(): the NMI can land in the middle
+; of a neslib call that uses the same zero page scratch. A DMC fetch during a
+; $4016 read can drop a bit, so the pad is read until two reads agree.
+
+	.include "mapper.inc"
+
+.if(NES_INPUT_LATCH)
+
+	.export _input_nmi_update,_input_trigger,_input_held
+
+.if(NES_MAPPER <> 0 .or NES_AUDIO_MAIN_LOOP)
+	.import _mapper_nmi_update
+NMI_UPDATE = _mapper_nmi_update
+.else
+	.import _famitone_update
+NMI_UPDATE = _famitone_update
+.endif
+
+CTRL_PORT1	= $4016
+
+.segment "BSS"
+
+_input_held:	.res 1		;buttons down at the last NMI
+input_pressed:	.res 1		;buttons that went down since the logic last took them
+input_taken:	.res 1		;presses input_trigger() returned since the last NMI
+input_first:	.res 1		;first of the two reads
+input_bits:	.res 1
+
+.segment "CODE"
+
+;void __fastcall__ input_nmi_update(void);
+
+_input_nmi_update:
+
+@read:
+	jsr input_read
+	sta input_first
+	jsr input_read
+	cmp input_first
+	bne @read		;a DMC fetch shifted one of the reads, try again
+
+	lda _input_held
+	eor #$ff
+	and input_first
+	sta input_bits		;went down since the last NMI
+
+	lda input_taken
+	eor #$ff
+	and input_pressed	;drop what the logic took
+	ora input_bits
+	sta input_pressed
+	lda #0
+	sta input_taken
+
+	lda input_first
+	sta _input_held
+
+	jmp NMI_UPDATE
+
+
+;strobe the pad and shift in its 8 buttons, A in bit 0 (neslib PAD_* order)
+
+input_read:
+
+	ldx #1
+	stx CTRL_PORT1
+	dex
+	stx CTRL_PORT1
+	ldx #8
+@bit:
+	lda CTRL_PORT1
+	lsr a
+	ror input_bits
+	dex
+	bne @bit
+	lda input_bits
+	rts
+
+
+;unsigned char __fastcall__ input_trigger(void);
+
+_input_trigger:
+
+	lda input_taken
+	eor #$ff
+	and input_pressed	;presses not returned yet
+	tax
+	ora input_taken		;if an NMI hits before this store, the bits stored
+	sta input_taken		;were taken already and the next NMI drops them again
+	txa
+	ldx #0
+	rts
+
+.endif
@@ -0,0 +1,145 @@
+
+#ifndef _MAPPER_H
+#define _MAPPER_H
+
+//------------------------------------------------------------------------------//
+//                 Cartridge Board Selection and Bank Switching                 //
+//------------------------------------------------------------------------------//
+
+// NES_MAPPER selects the board the game is built for:
+//   0 = NROM  (32K PRG, 8K CHR-ROM, everything always mapped)
+//   1 = MMC1  (SKROM: 128K PRG in 16K banks, 8K CHR-ROM, 8K WRAM at $6000)
+//   4 = MMC3  (TKROM: 128K PRG in 8K banks, 8K CHR-ROM, 8K WRAM, scanline IRQ)
+//
+// Changing it takes three edits that must agree:
+//   - NES_MAPPER below (C side)
+//   - NES_MAPPER in mapper.inc (assembly side)
+//   - CFGFILE at the top of hollow_nes.c (hollow_nes_nrom/mmc1/mmc3.cfg)
+#ifndef NES_MAPPER
+#define NES_MAPPER 0
+#endif
+
+#define MAPPER_BANKED (NES_MAPPER != 0)     // Switchable PRG banks and WRAM
+#define MAPPER_IRQ    (NES_MAPPER == 4)     // Scanline IRQ
+
+// Switchable 16K banks mapped at $8000 (MMC3 maps them as two 8K halves). The last
+// 16K is fixed at $C000 and holds the code, neslib, FamiTone, sound effects and all
+// RAM initializers.
+#define BANK_ROOMS     0   // Room nametables (segment ROOMS), mapped during gameplay
+#define BANK_DIALOGUE  1   // Dialogue text (segment DIALOGUE)
+#define BANK_MUSIC     2   // FamiTone song data (segment MUSIC), mapped by the NMI audio tick
+#define BANK_TILESETS  3   // Compressed CHR tilesets (segment TILESETS), CHR-RAM build only
+
+// CHR_RAM builds the board with 8K CHR-RAM instead of CHR-ROM (NROM, SNROM or
+// TNROM). Tilesets are then stored RLE-compressed in PRG (chr_tilesets.s, made by
+// tools/chr_pack.py) and streamed into the pattern tables when the area changes.
+// Must match NES_CHR_RAM in mapper.inc.
+#ifndef CHR_RAM
+#define CHR_RAM 0
+#endif
+
+// AUDIO_MAIN_LOOP moves the FamiTone tick out of the NMI: the NMI keeps only
+// the PPU work (and the MMC3 splits / CHR animation), and the main loop calls
+// audio_update() right after ppu_wait_nmi(). The NMI length then no longer
+// depends on the music and SFX density, and the audio cost shows up in the
+// frame where it is spent. Must match NES_AUDIO_MAIN_LOOP in mapper.inc.
+#ifndef AUDIO_MAIN_LOOP
+#define AUDIO_MAIN_LOOP 0
+#endif
+
+#if MAPPER_BANKED
+
+// Reset the mapper: last 16K fixed at $C000, CHR-ROM mapped 1:1, WRAM enabled
+void __fastcall__ mapper_init(void);
+
+// Map a 16K bank at $8000 (NMI-safe)
+void __fastcall__ bank_select(unsigned char bank);
+
+// Map a bank and remember the previous one; pair every push with a pop
+void __fastcall__ bank_push(unsigned char bank);
+void __fastcall__ bank_pop(void);
+
+// Call a function living in a switchable bank, restoring the current bank afterwards
+void __fastcall__ banked_call(unsigned char bank, void (*fn)(void));
+
+// NMI callback: arms the scanline IRQ (MMC3), then runs the FamiTone update
+// with the music bank mapped (unless AUDIO_MAIN_LOOP)
+void __fastcall__ mapper_nmi_update(void);
+
+#else
+
+// NROM: everything is always mapped, so bank switching compiles away
+#define mapper_init()
+#define bank_select(bank)
+#define bank_push(bank)
+#define bank_pop()
+#define banked_call(bank, fn) (fn)()
+
+#if AUDIO_MAIN_LOOP
+void __fastcall__ mapper_nmi_update(void);  // does nothing
+#else
+#define mapper_nmi_update famitone_update
+#endif
+
+#endif
+
+#if MAPPER_IRQ
+
+//------------------------------------------------------------------------------//
+//                        Scanline IRQ Screen Splits (MMC3)                     //
+//------------------------------------------------------------------------------//
+
+// Raster splits driven by the MMC3 scanline counter instead of a sprite 0 busy-wait.
+// The main loop describes the splits it wants; the NMI arms the first IRQ of the frame,
+// and each IRQ applies its split during hblank and arms the next one. The CPU runs game
+// logic in between instead of spinning on $2002.
+//
+// A split moves the picture from the given scanline down: that scanline shows pixel
+// row y of the nametable, starting at pixel column x. Splits must be added in
+// increasing scanline order, and the list stays active every frame until it is
+// cleared. The dialogue box uses two of them (load_dialogue_box()).
+
+#define IRQ_MAX_SPLITS 4
+
+// Remove all splits
+void __fastcall__ irq_split_clear(void);
+
+// Add a split at a scanline (1..239): x and y are the nametable pixel column and
+// row drawn there, nametable the nametable number (0..3, as in PPUCTRL)
+void __fastcall__ irq_split_add(unsigned char scanline, unsigned char x, unsigned char y, unsigned char nametable);
+
+#else
+
+#define irq_split_clear()
+#define irq_split_add(scanline, x, y, nametable)
+
+#endif
+
+#define MAPPER_CHR_ANIM (NES_MAPPER == 4 && !CHR_RAM)   // 1K CHR-ROM banks
+
+#if MAPPER_CHR_ANIM
+
+//------------------------------------------------------------------------------//
+//                  Background Tile Animation by CHR Bank Cycling               //
+//------------------------------------------------------------------------------//
+
+// MMC3 maps the background pattern table as four 1K banks. The NMI steps the one
+// at $0C00 (tiles $C0-$FF) through consecutive CHR-ROM banks, so spikes, lamps or
+// water drawn with those tiles animate for one register write per step, with no
+// nametable updates. Each animation frame is a full 1K bank of CHR-ROM holding
+// the same 64 tiles in a different pose; the base tileset uses banks 0-3.
+
+// Cycle $0C00 through banks first .. first+frames-1, one step every delay frames (>= 1)
+void __fastcall__ chr_anim_start(unsigned char first, unsigned char frames, unsigned char delay);
+
+// Stop cycling and map the base tileset's bank 3 back
+void __fastcall__ chr_anim_stop(void);
+
+#else
+
+#define chr_anim_start(first, frames, delay)
+#define chr_anim_stop()
+
+#endif
+
+#endif // mapper.h
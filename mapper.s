@@ -0,0 +1,548 @@
+
+;------------------------------------------------------------------------------;
+;            Mapper runtime - bank switching and far-call trampoline           ;
+;------------------------------------------------------------------------------;
+
+; MMC1 (SKROM) and MMC3 (TKROM) support for the bank-switched builds, see
+; mapper.h. Both boards present the same layout to the game:
+;
+;   $8000-$BFFF  switchable 16K bank (rooms, dialogue, music, ...)
+;   $C000-$FFFF  fixed: code, neslib, FamiTone, vectors
+;
+; The bank registers take more than one write (MMC1: 5-write serial port,
+; MMC3: select + data). If the NMI switched banks in the middle of such a
+; sequence the register would be corrupted, so the main thread raises
+; bank_lock while it writes and the NMI audio tick postpones itself to the
+; next frame when it sees the lock.
+
+	.include "mapper.inc"
+
+.if(NES_MAPPER <> 0)
+
+	.import popa
+	.import _famitone_update
+
+	.export _mapper_init
+	.export _bank_select,_bank_push,_bank_pop
+	.export _banked_call
+	.export _mapper_nmi_update
+
+BANK_MUSIC	= 2		;must match mapper.h
+
+BANK_STACK_SIZE	= 8
+
+.if(NES_MAPPER = 1)
+
+MMC1_CTRL	= $8000		;mirroring, PRG/CHR modes
+MMC1_CHR0	= $a000		;CHR bank for $0000 (whole 8K in 8K mode)
+MMC1_CHR1	= $c000		;CHR bank for $1000 (4K mode only)
+MMC1_PRG	= $e000		;PRG bank at $8000, bit 4 disables WRAM
+
+MMC1_CTRL_INIT	= %01111	;8K CHR, PRG mode 3, horizontal mirroring
+
+;write A to an MMC1 register, LSB first
+
+.macro mmc1_write reg
+	sta reg
+	lsr a
+	sta reg
+	lsr a
+	sta reg
+	lsr a
+	sta reg
+	lsr a
+	sta reg
+.endmacro
+
+;map 16K bank A at $8000
+
+.macro prg_write
+	mmc1_write MMC1_PRG
+.endmacro
+
+.endif
+
+.if(NES_MAPPER = 4)
+
+MMC3_SELECT	= $8000		;bank register select + PRG/CHR modes
+MMC3_DATA	= $8001		;bank number for the selected register
+MMC3_MIRROR	= $a000		;0 vertical, 1 horizontal
+MMC3_WRAM	= $a001		;bit 7 enables WRAM, bit 6 write-protects it
+MMC3_IRQ_LATCH	= $c000		;scanline count reloaded into the counter
+MMC3_IRQ_RELOAD	= $c001		;reload the counter at the next scanline
+MMC3_IRQ_OFF	= $e000		;disable and acknowledge the IRQ
+MMC3_IRQ_ON	= $e001		;enable the IRQ
+
+MMC3_MODE	= $80		;PRG mode 0 ($C000 fixed), CHR A12 inverted: 1K banks at $0000
+
+;map 16K bank A at $8000 as two 8K banks (R6 at $8000, R7 at $a000)
+
+.macro prg_write
+	asl a
+	tax
+	lda #MMC3_MODE|6
+	sta MMC3_SELECT
+	stx MMC3_DATA
+	inx
+	lda #MMC3_MODE|7
+	sta MMC3_SELECT
+	stx MMC3_DATA
+.endmacro
+
+.endif
+
+
+.segment "ZEROPAGE"
+
+bank_current:	.res 1		;bank mapped at $8000
+bank_lock:	.res 1		;non-zero while the main thread writes a bank register
+audio_pending:	.res 1		;audio ticks postponed by bank_lock
+call_ptr:	.res 2		;target of banked_call
+
+.segment "BSS"
+
+bank_sp:	.res 1
+bank_stack:	.res BANK_STACK_SIZE
+
+.segment "CODE"
+
+
+;void __fastcall__ mapper_init(void);
+
+_mapper_init:
+
+.if(NES_MAPPER = 1)
+	lda #$80
+	sta MMC1_CTRL		;reset the shift register
+	lda #MMC1_CTRL_INIT
+	mmc1_write MMC1_CTRL
+	lda #0
+	mmc1_write MMC1_CHR0
+.endif
+
+.if(NES_MAPPER = 4)
+	sta MMC3_IRQ_OFF
+	ldx #0
+@chr:
+	txa
+	ora #MMC3_MODE
+	sta MMC3_SELECT
+	lda @chrBanks,x		;map the 8K CHR-ROM 1:1
+	sta MMC3_DATA
+	inx
+	cpx #6
+	bne @chr
+	lda #1
+	sta MMC3_MIRROR		;horizontal mirroring
+	lda #$80
+	sta MMC3_WRAM		;WRAM enabled, writable
+	lda #0
+	sta irq_count
+	sta chr_anim_frames
+.endif
+
+	lda #0
+	sta bank_sp
+	sta bank_lock
+	sta audio_pending
+	jmp _bank_select	;map bank 0
+
+.if(NES_MAPPER = 4)
+@chrBanks:
+	.byte 4,6,0,1,2,3	;R0-R1 2K at $1000 (sprites), R2-R5 1K at $0000 (background)
+.endif
+
+
+;void __fastcall__ bank_select(unsigned char bank);
+
+_bank_select:
+
+	inc bank_lock
+	sta bank_current
+	prg_write
+	dec bank_lock
+	rts
+
+
+;void __fastcall__ bank_push(unsigned char bank);
+
+_bank_push:
+
+	ldx bank_sp
+	ldy bank_current
+	sty bank_stack,x
+	inc bank_sp
+	jmp _bank_select
+
+
+;void __fastcall__ bank_pop(void);
+
+_bank_pop:
+
+	dec bank_sp
+	ldx bank_sp
+	lda bank_stack,x
+	jmp _bank_select
+
+
+;void __fastcall__ banked_call(unsigned char bank, void (*fn)(void));
+
+_banked_call:
+
+	sta call_ptr
+	stx call_ptr+1
+	jsr popa		;bank
+	jsr _bank_push
+	jsr @call
+	jmp _bank_pop
+
+@call:
+
+	jmp (call_ptr)
+
+
+;void __fastcall__ mapper_nmi_update(void);
+;called from the NMI
+
+_mapper_nmi_update:
+
+.if(NES_MAPPER = 4)
+	jsr irq_arm		;first split of the new frame
+.endif
+
+.if(NES_AUDIO_MAIN_LOOP)
+
+.if(NES_MAPPER = 4)
+	lda bank_lock
+	bne @done
+	jsr chr_anim_tick	;shares the select register, so only when unlocked
+@done:
+.endif
+	rts			;audio_update() ticks FamiTone from the main loop
+
+.else
+
+	lda bank_lock
+	beq @run
+	inc audio_pending	;main thread is mid-write, tick next frame
+	rts
+
+@run:
+
+.if(NES_MAPPER = 4)
+	jsr chr_anim_tick	;shares the select register, so only when unlocked
+.endif
+
+	lda #BANK_MUSIC
+	prg_write
+
+@tick:
+
+	jsr _famitone_update
+	lda audio_pending
+	beq @restore
+	dec audio_pending	;catch up on a postponed tick
+	jmp @tick
+
+@restore:
+
+	lda bank_current
+	prg_write
+	rts
+
+.endif
+
+
+.if(NES_MAPPER = 1)
+
+;reset stub, placed at $xFF0 of every bank
+;MMC1 may power up with any bank at $C000, so each bank carries the same code
+;and vectors. Writing a value with bit 7 set resets the mapper into PRG mode 3,
+;which maps the fixed bank, and the jump continues at its real reset vector.
+;The fixed bank gets the code only; crt0 provides its vectors.
+
+.macro reset_stub seg, vectors
+.segment seg
+	sei
+	ldx #$ff
+	txs
+	stx MMC1_CTRL
+	jmp ($fffc)
+.if(vectors)
+	.word $fff0,$fff0,$fff0	;NMI, reset, IRQ as seen from $C000
+.endif
+.endmacro
+
+	reset_stub "STUB0",1
+	reset_stub "STUB1",1
+	reset_stub "STUB2",1
+	reset_stub "STUB3",1
+	reset_stub "STUB4",1
+	reset_stub "STUB5",1
+	reset_stub "STUB6",1
+	reset_stub "STUB7",0
+
+.endif
+
+
+.if(NES_MAPPER = 4)
+
+;------------------------------------------------------------------------------;
+;                       Scanline IRQ screen splits (MMC3)                      ;
+;------------------------------------------------------------------------------;
+
+; irq_line and the irq_hi/irq_y/irq_x/irq_lo writes hold the splits in
+; scanline order. The NMI arms the counter for the first one; each IRQ moves
+; the PPU to its split's position and re-arms the counter with the distance
+; to the next split.
+;
+; The position is set with the $2006/$2005/$2005/$2006 sequence: PPUCTRL and
+; $2005 alone cannot change the Y scroll or the vertical nametable bit in
+; mid-frame. Only the last $2006 write takes effect at once, so the first
+; three can land anywhere in the line.
+; The MMC3 counter clocks on PPU A12 rising edges, which needs the background
+; at $0000 and sprites at $1000 (bank_bg(0), bank_spr(1)).
+
+	.import incsp3
+	.importzp tmp1
+
+	.export _irq_split_clear,_irq_split_add
+
+	.interruptor irq_handler
+
+IRQ_MAX_SPLITS	= 4		;must match mapper.h
+
+PPU_STATUS	= $2002
+PPU_SCROLL	= $2005
+PPU_ADDR	= $2006
+
+.segment "ZEROPAGE"
+
+irq_count:	.res 1		;number of splits in the list
+irq_index:	.res 1		;next split to apply this frame
+
+.segment "BSS"
+
+irq_line:	.res IRQ_MAX_SPLITS	;first scanline of the split
+irq_hi:		.res IRQ_MAX_SPLITS	;$2006: nametable bits
+irq_y:		.res IRQ_MAX_SPLITS	;$2005: Y (fine Y, coarse Y)
+irq_x:		.res IRQ_MAX_SPLITS	;$2005: X (fine X)
+irq_lo:		.res IRQ_MAX_SPLITS	;$2006: coarse Y low bits, coarse X
+
+.segment "CODE"
+
+
+;void __fastcall__ irq_split_clear(void);
+
+_irq_split_clear:
+
+	lda #0
+	sta irq_count
+	rts
+
+
+;void __fastcall__ irq_split_add(unsigned char scanline, unsigned char x, unsigned char y, unsigned char nametable);
+;entries are written before irq_count grows, so the NMI never sees a half-built split
+
+_irq_split_add:
+
+	and #$03
+	asl a
+	asl a
+	ldx irq_count
+	cpx #IRQ_MAX_SPLITS
+	bcs @full
+	sta irq_hi,x
+	jsr popa		;y
+	sta irq_y,x
+	and #$f8
+	asl a
+	asl a
+	sta tmp1		;coarse Y bits 0-2 in bits 5-7
+	jsr popa		;x
+	sta irq_x,x
+	lsr a
+	lsr a
+	lsr a
+	ora tmp1
+	sta irq_lo,x
+	jsr popa		;scanline
+	sta irq_line,x
+	inc irq_count
+	rts
+
+@full:
+
+	jmp incsp3		;list full, drop the split
+
+
+;called from the NMI: arm the counter for the first split
+
+irq_arm:
+
+	sta MMC3_IRQ_OFF
+	lda #0
+	sta irq_index
+	lda irq_count
+	beq @done
+	lda irq_line		;reloaded on the pre-render line, 0 at the end of line-1
+	sta MMC3_IRQ_LATCH
+	sta MMC3_IRQ_RELOAD
+	sta MMC3_IRQ_ON
+
+@done:
+
+	rts
+
+
+;IRQ interruptor: apply the current split and arm the next one
+
+irq_handler:
+
+	pha
+	txa
+	pha
+
+	sta MMC3_IRQ_OFF	;acknowledge
+	ldx irq_index
+	cpx irq_count
+	bcs @done		;list was cleared mid-frame
+
+	bit PPU_STATUS		;reset the $2005/$2006 write latch
+	lda irq_hi,x
+	sta PPU_ADDR
+	lda irq_y,x
+	sta PPU_SCROLL
+	lda irq_x,x
+	sta PPU_SCROLL
+	lda irq_lo,x
+	sta PPU_ADDR		;the new position applies from here
+
+	inx
+	stx irq_index
+	cpx irq_count
+	bcs @done
+	lda irq_line,x		;scanlines until the next split
+	clc
+	sbc irq_line-1,x	;minus one for the reload line
+	sta MMC3_IRQ_LATCH
+	sta MMC3_IRQ_RELOAD
+	sta MMC3_IRQ_ON
+
+@done:
+
+	pla
+	tax
+	pla
+	sec			;IRQ handled
+	rts
+
+;------------------------------------------------------------------------------;
+;                  Background tile animation by CHR bank cycling               ;
+;------------------------------------------------------------------------------;
+
+; The 1K CHR bank at $0C00 (background tiles $C0-$FF, register R5) steps
+; through consecutive CHR-ROM banks on a timer from the NMI. Every tile in the
+; slot animates for one register write, without touching the nametables.
+
+	.export _chr_anim_start,_chr_anim_stop
+
+CHR_ANIM_REG	= 5		;R5 = $0C00-$0FFF
+CHR_ANIM_HOME	= 3		;bank R5 maps when nothing animates
+
+.segment "ZEROPAGE"
+
+chr_anim_frames:	.res 1	;number of banks in the cycle, 0 = off
+chr_anim_base:		.res 1	;first bank of the cycle
+chr_anim_delay:		.res 1	;frames per step
+chr_anim_timer:		.res 1	;frames until the next step
+chr_anim_frame:		.res 1	;current step
+
+.segment "CODE"
+
+
+;void __fastcall__ chr_anim_start(unsigned char first, unsigned char frames, unsigned char delay);
+
+_chr_anim_start:
+
+	ldx #0
+	stx chr_anim_frames	;keep the NMI out while the cycle is set up
+	sta chr_anim_delay
+	ldx #1
+	stx chr_anim_timer	;step on the next NMI...
+	dex
+	dex
+	stx chr_anim_frame	;...to frame 0
+	jsr popa
+	tay			;frames
+	jsr popa
+	sta chr_anim_base
+	sty chr_anim_frames
+	rts
+
+
+;void __fastcall__ chr_anim_stop(void);
+
+_chr_anim_stop:
+
+	lda #0
+	sta chr_anim_frames
+	inc bank_lock
+	lda #MMC3_MODE|CHR_ANIM_REG
+	sta MMC3_SELECT
+	lda #CHR_ANIM_HOME
+	sta MMC3_DATA
+	dec bank_lock
+	rts
+
+
+;called from the NMI with bank_lock clear
+
+chr_anim_tick:
+
+	lda chr_anim_frames
+	beq @done
+	dec chr_anim_timer
+	bne @done
+	lda chr_anim_delay
+	sta chr_anim_timer
+	ldx chr_anim_frame
+	inx
+	cpx chr_anim_frames
+	bcc @set
+	ldx #0
+
+@set:
+
+	stx chr_anim_frame
+	txa
+	clc
+	adc chr_anim_base
+	tax
+	lda #MMC3_MODE|CHR_ANIM_REG
+	sta MMC3_SELECT
+	stx MMC3_DATA
+
+@done:
+
+	rts
+
+.endif
+
+.endif
+
+
+.if(NES_MAPPER = 0 .and NES_AUDIO_MAIN_LOOP)
+
+	.export _mapper_nmi_update
+
+;void __fastcall__ mapper_nmi_update(void);
+;NROM with the audio tick in the main loop: nothing left to do in the NMI
+
+.segment "CODE"
+
+_mapper_nmi_update:
+
+	rts
+
+.endif
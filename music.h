@@ -0,0 +1,20 @@
+// Generated by tools/music_pack.py, do not edit
+
+#ifndef _MUSIC_H
+#define _MUSIC_H
+
+// Song numbers for music_play()
+#define MUSIC_MENU 0
+#define MUSIC_GAME 1
+#define MUSIC_HORNET 2
+
+#define MUSIC_SONGS 3
+
+// DPCM sample numbers for sample_play()
+#define SAMPLE_IMPACT 1
+#define SAMPLE_THUD 2
+
+// All songs in one FamiTone2 set (segment MUSIC, bank BANK_MUSIC)
+extern char music_data[];
+
+#endif // music.h
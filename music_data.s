@@ -0,0 +1,474 @@
+; Generated by tools/music_pack.py, do not edit
+;MENU=assets/music/hollow_knight_theme.s GAME=assets/music/dirtmouth.s HORNET=assets/music/hornet.s IMPACT=assets/dpcm/impact.dmc:15 THUD=assets/dpcm/thud.dmc:13
+
+.segment "MUSIC"		;switchable music bank on MMC1/MMC3, see mapper.h
+
+.export _music_data
+.global FAMISTUDIO_DPCM_PTR
+
+_music_data:
+	.byte 3
+	.word @instruments
+	.word @samples-3
+; 00 : MENU
+	.word @song0ch0
+	.word @song0ch1
+	.word @song0ch2
+	.word @song0ch3
+	.word @song0ch4
+	.word 307,256
+; 01 : GAME
+	.word @song1ch0
+	.word @song1ch1
+	.word @song1ch2
+	.word @song1ch3
+	.word @song1ch4
+	.word 307,256
+; 02 : HORNET
+	.word @song2ch0
+	.word @song2ch1
+	.word @song2ch2
+	.word @song2ch3
+	.word @song2ch4
+	.word 307,256
+
+@instruments:
+	.byte $f0 ; 00 : MENU LeadIntro
+	.word @env1, @env2, @env2
+	.byte $00
+	.byte $30 ; 01 : MENU LeadLo
+	.word @env3, @env2, @env2
+	.byte $00
+	.byte $30 ; 02 : MENU Meu Instrumento, HORNET Meu Instrumento
+	.word @env0, @env2, @env2
+	.byte $00
+	.byte $f0 ; 03 : GAME Bleep
+	.word @env4, @env2, @env2
+	.byte $00
+	.byte $70 ; 04 : GAME LeadIntro
+	.word @env5, @env2, @env2
+	.byte $00
+	.byte $70 ; 05 : GAME LeadLo
+	.word @env6, @env2, @env2
+	.byte $00
+	.byte $70 ; 06 : HORNET LeadIntro
+	.word @env7, @env2, @env2
+	.byte $00
+	.byte $70 ; 07 : HORNET LeadLo
+	.word @env8, @env2, @env2
+	.byte $00
+
+@env0:
+	.byte $cf,$7f,$00,$00
+@env1:
+	.byte $c1,$c2,$c3,$c4,$c5,$c6,$c7,$c7,$c8,$c8,$c7,$00,$0a
+@env2:
+	.byte $c0,$7f,$00,$01
+@env3:
+	.byte $cc,$04,$cb,$04,$ca,$04,$c9,$03,$c8,$04,$c7,$03,$c6,$08,$c5,$06,$c4,$05,$c3,$03,$c2,$00,$14
+@env4:
+	.byte $c3,$5d,$c2,$32,$c1,$2b,$c0,$00,$06
+@env5:
+	.byte $c6,$2f,$c5,$42,$c4,$27,$c3,$29,$c1,$24,$c0,$00,$0a
+@env6:
+	.byte $c8,$04,$c7,$06,$c6,$05,$c5,$06,$c4,$09,$c3,$08,$c2,$07,$c1,$24,$c0,$00,$10
+@env7:
+	.byte $c6,$02,$c5,$05,$c4,$07,$c3,$11,$c2,$14,$c1,$1f,$c0,$00,$0c
+@env8:
+	.byte $c6,$04,$c5,$06,$c4,$05,$c3,$07,$c2,$0a,$c1,$06,$c0,$00,$0c
+
+@samples:
+	.byte <((dpcm_impact & $3fff) >> 6),$14,$0f ; 01 : IMPACT, 321 bytes
+	.byte <((dpcm_thud & $3fff) >> 6),$13,$0d ; 02 : THUD, 305 bytes
+
+@song0ch0:
+	.byte $fb, $01, $82, $62, $ef, $62, $f3, $66, $b7, $68, $bb, $66, $f9, $f9, $e9, $62, $b5, $58, $b7, $5a, $f3, $58, $b7, $54
+	.byte $bb, $58, $f9, $f9, $e9, $62, $ef, $62, $f3, $66, $b7, $68, $bb, $6c, $f9, $f9, $e9, $70, $b5, $68, $b7, $66, $bb, $62
+	.byte $b5, $5e, $f5, $62, $f9, $f9, $e9, $00, $f9, $f9, $e9
+@song0ref60:
+	.byte $4a, $ef, $4a, $f3, $4e, $b7, $50, $bb, $4e, $f9, $f9, $e9, $4a, $b5, $40, $b7, $42, $f3, $40, $b7, $3c, $bb, $40, $f9
+	.byte $f9, $e9, $4a, $ef, $4a, $f3, $4e, $b7, $50, $bb, $54, $f9, $f9, $e9, $58, $97, $5a, $9b, $58, $f5, $50, $ef, $46, $bb
+	.byte $4a, $ef, $46, $f9, $b3, $3c, $bb, $40, $f9, $eb, $32, $f5, $f9, $f9, $eb, $d7, $40, $f9, $f9, $91, $f9, $ed, $48, $f5
+	.byte $48, $f9, $f9, $e9, $4a, $f9, $f9, $ab, $4e, $9b, $50, $9d, $54, $f9, $f9, $e9, $58, $f9, $b3, $5e, $f9, $b3, $62, $f9
+	.byte $f9, $e9
+@song0ch0loop:
+	.byte $00, $fd
+	.word @song0ch0loop
+@song0ch1:
+	.byte $80, $32, $b5, $40, $b7, $42, $f9, $f1, $32, $b5, $3c, $b7, $40, $f9, $f1, $32, $b5, $38, $b7, $3c, $f9, $f1, $32, $b5
+	.byte $36, $b7, $38, $bb, $36, $b5, $2e, $f5, $32, $b5, $40, $b7, $42, $f9, $f1, $2e, $b5, $40, $b7, $3c, $f9, $f1, $2a, $b5
+	.byte $38, $b7, $3c, $f9, $f1, $24, $b5, $2e, $b7, $32, $bb, $3c, $b5, $32, $b7, $2e, $bb, $3c, $f9, $eb, $20, $f5, $1a, $b5
+	.byte $28, $b7, $2a, $f9, $f1, $1a, $b5, $24, $b7, $28, $f9, $f1, $1a, $b5, $20, $b7, $24, $f9, $f1, $16, $b5, $20, $b7, $1e
+	.byte $f3, $16, $f5, $12, $b5, $20, $b7, $24, $f9, $f1, $0c, $b5, $1a, $b7, $24, $bb, $28, $b5, $2a, $b7, $32, $bb, $08, $b5
+	.byte $1a, $b7, $20, $bb, $28, $b5, $32, $b7, $22, $bb, $14, $b5, $22, $b7, $18, $bb, $24, $b5
+@song0ref301:
+	.byte $1e, $f5, $1a, $b5, $28, $b7, $2a, $bb, $28, $b5, $2a, $b7, $28, $bb, $1a, $b5, $24, $b7, $28, $bb, $24, $b5, $28, $b7
+	.byte $24, $bb, $1a, $b5, $20, $b7, $24, $bb, $20, $b5, $24, $b7, $20, $bb, $1e, $ef, $18, $f3, $ff, $26
+	.word @song0ref301
+	.byte $16, $b5, $1e, $b7, $24, $bb, $2e, $b5, $36, $f5, $36, $f9, $f9, $e9
+@song0ch1loop:
+	.byte $00, $fd
+	.word @song0ch1loop
+@song0ch2:
+@song0ref365:
+	.byte $f9, $f9, $eb, $f9, $f9, $eb, $f9, $f9, $eb, $f9, $f9, $eb, $f9, $f9, $eb, $f9, $f9, $eb, $f9, $f9, $eb, $f9, $f9, $eb
+	.byte $f9, $f9, $eb, $84, $ff, $26
+	.word @song0ref60
+	.byte $00, $f9, $f9, $e9, $ff, $1b
+	.word @song0ref365
+	.byte $f9, $f9, $eb
+@song0ch2loop:
+	.byte $00, $fd
+	.word @song0ch2loop
+@song0ch3:
+	.byte $ff, $1b
+	.word @song0ref365
+	.byte $ff, $1b
+	.word @song0ref365
+	.byte $ff, $18
+	.word @song0ref365
+@song0ch3loop:
+	.byte $00, $fd
+	.word @song0ch3loop
+@song0ch4:
+	.byte $ff, $1b
+	.word @song0ref365
+	.byte $ff, $1b
+	.word @song0ref365
+	.byte $ff, $18
+	.word @song0ref365
+@song0ch4loop:
+	.byte $00, $fd
+	.word @song0ch4loop
+@song1ch0:
+	.byte $fb, $01
+@song1ch0loop:
+	.byte $88, $3e, $f9, $f9, $d9, $f9, $83, $3e, $d1, $40, $d1, $44, $a7, $3e, $f9, $f9, $85, $30, $d1, $34, $f9, $f9, $d9, $3e
+	.byte $f9, $f9, $d9, $00, $f9, $81, $3e, $d1, $40, $d1, $44, $a7, $3a, $f9, $f9, $85, $40, $a7, $3e, $a7, $40, $f9, $f9, $85
+	.byte $30, $d1
+@song1ref54:
+	.byte $56
+@song1ref55:
+	.byte $f9, $f9, $d9, $00, $f9, $ab, $56, $a7, $58, $d1, $5c, $a7, $56, $f9, $f9, $85, $48, $d1, $4c, $f9, $f9, $d9, $52, $f9
+	.byte $f9, $d9, $56, $f9, $ab, $58, $d1, $5c, $d1, $60, $f9, $f9, $85, $62, $d1, $60, $f9, $ab, $58, $f9, $ab, $00, $f9, $f9
+	.byte $d9, $f9, $f9, $db, $f9, $f9, $87, $60, $d1, $64, $f9, $ab, $6a, $d1, $5c, $d1, $6a
+@song1ref120:
+	.byte $f9, $f9, $d9, $56, $f9, $ab, $56, $a7, $58, $a7, $58, $a7, $5c, $a7, $56, $f9, $81, $4e, $a7, $4a, $a7, $4e, $f9, $81
+	.byte $4a, $f9, $ab, $4e, $d1, $52, $d1, $52, $ff, $0f
+	.word @song1ref55
+	.byte $d9, $58, $f9, $f9, $85, $5c, $d1, $60, $f9, $f9, $d9, $00, $f9, $ab
+@song1ref169:
+	.byte $60, $a7, $62, $d1, $66, $a7, $60, $f9, $ab, $64, $f9, $ab, $66, $f9, $f9, $d9, $6a, $f9, $ab, $5c, $d1, $60, $a7, $62
+	.byte $a7, $60, $f9, $f9, $d9, $5c, $f9, $d5, $60, $d1, $62, $a7, $5e, $f9, $f9, $d9, $52, $f9, $f9, $d9, $54, $a7, $58, $a7
+	.byte $5c, $a7, $60, $a7, $6a, $a7, $6e, $a7, $70, $a7, $78, $a7, $02, $f9, $f9, $d9, $fd
+	.word @song1ch0loop
+@song1ch1:
+@song1ch1loop:
+	.byte $8a
+@song1ref238:
+	.byte $0a, $a7, $18
+@song1ref241:
+	.byte $a7, $22, $a7, $26, $a7, $28, $a7, $30, $a7, $28, $a7, $26, $a7, $ff, $10
+	.word @song1ref238
+	.byte $ff, $10
+	.word @song1ref238
+	.byte $ff, $10
+	.word @song1ref238
+	.byte $ff, $10
+	.word @song1ref238
+	.byte $06, $a7, $14, $ff, $0d
+	.word @song1ref241
+	.byte $02, $a7, $10, $a7, $22, $a7, $26, $a7, $28, $d1, $30, $d1, $02, $a7, $1a, $a7, $22, $a7, $28, $a7, $32, $a7, $22, $a7
+	.byte $06, $d1, $ff, $10
+	.word @song1ref238
+	.byte $ff, $10
+	.word @song1ref238
+	.byte $ff, $10
+	.word @song1ref238
+	.byte $ff, $10
+	.word @song1ref238
+	.byte $02, $a7, $10, $a7, $1a, $a7, $1e, $a7, $22, $d1, $28, $d1, $1e, $a7, $26, $a7, $28, $a7, $30, $a7, $30, $d1, $26, $d1
+	.byte $0c, $a7, $1a, $a7, $24, $a7, $2c, $a7, $32, $a7, $3c
+@song1ref345:
+	.byte $a7, $32, $a7, $2c, $a7, $10, $a7, $1e, $a7, $28, $a7, $30, $a7, $36, $d1, $30, $d1, $ff, $10
+	.word @song1ref238
+	.byte $ff, $10
+	.word @song1ref238
+	.byte $ff, $10
+	.word @song1ref238
+	.byte $ff, $10
+	.word @song1ref238
+	.byte $1a, $a7, $28, $a7, $36, $a7, $3a, $a7, $40, $a7, $36, $a7, $28, $a7, $1a, $a7, $18, $a7, $26, $a7, $30, $a7, $34, $a7
+	.byte $36, $a7, $34, $a7, $30, $a7, $26, $a7, $10, $a7, $1e, $a7, $28, $a7, $30, $a7, $36, $a7, $28, $a7, $1e, $d1, $14, $a7
+	.byte $22, $a7, $2c, $a7, $36, $a7, $34, $a7, $2c, $a7, $22, $a7, $14, $a7, $0a, $a7, $10, $a7, $18, $a7, $22, $a7
+@song1ref444:
+	.byte $26, $a7, $22, $a7, $18, $a7, $10, $a7, $02, $a7, $10, $a7, $1a, $a7, $22, $a7, $26, $a7, $22, $a7, $10, $d1, $02, $d1
+	.byte $1a, $a7, $22, $a7, $26, $a7, $22, $a7, $1a, $a7, $22
+@song1ref479:
+	.byte $a7, $02, $a7, $10, $a7, $18, $a7, $22, $a7, $28, $a7, $22, $a7, $0c, $a7, $1e, $a7, $0a, $a7, $18, $a7, $22, $d1, $ff
+	.byte $10
+	.word @song1ref444
+	.byte $28, $a7, $22, $a7, $1a, $a7, $10, $a7, $02, $a7, $14, $a7, $1c, $a7, $22, $a7, $24, $a7, $22, $a7, $1c, $a7, $14, $ff
+	.byte $0d
+	.word @song1ref479
+	.byte $18, $a7, $22, $a7, $0c, $a7, $1a, $a7, $24, $a7, $2c, $a7, $32, $a7, $3a, $ff, $0d
+	.word @song1ref345
+	.byte $3a, $f9, $ab, $14, $a7, $24, $a7, $2c, $a7, $32, $a7, $00, $a7, $32, $a7, $2c, $a7, $24, $a7, $16, $a7, $0c, $a7, $18
+	.byte $a7, $1e, $a7, $24, $a7, $2e, $a7, $24, $a7, $1e, $a7, $02, $a7, $10, $a7, $1a, $a7, $22, $a7, $28, $d1, $22, $d1, $0a
+	.byte $a7, $18, $a7, $22, $a7, $26, $a7, $28, $a7, $30, $a7, $3a, $a7, $40, $a7, $48, $f9, $f9, $d9, $fd
+	.word @song1ch1loop
+@song1ch2:
+@song1ch2loop:
+@song1ref620:
+	.byte $f9, $f9, $db, $f9, $f9, $db, $f9, $f9, $db, $f9, $f9, $db, $f9, $f9, $db, $f9, $f9, $db, $f9, $f9, $db, $f9, $f9, $db
+	.byte $86, $ff, $37
+	.word @song1ref54
+	.byte $db, $f9, $f9, $db, $52, $ff, $20
+	.word @song1ref120
+	.byte $f9, $f9, $d9, $f9, $ad, $56, $a7, $58, $d1, $5c, $a7, $56, $f9, $f9, $d9, $58, $f9, $f9, $85, $5c, $d1, $60, $f9, $f9
+	.byte $d9, $f9, $ad, $ff, $13
+	.word @song1ref169
+	.byte $00, $f9, $ab, $ff, $12
+	.word @song1ref620
+	.byte $fd
+	.word @song1ch2loop
+@song1ch3:
+@song1ch3loop:
+	.byte $ff, $18
+	.word @song1ref620
+	.byte $ff, $18
+	.word @song1ref620
+	.byte $ff, $18
+	.word @song1ref620
+	.byte $ff, $18
+	.word @song1ref620
+	.byte $ff, $15
+	.word @song1ref620
+	.byte $fd
+	.word @song1ch3loop
+@song1ch4:
+@song1ch4loop:
+	.byte $ff, $18
+	.word @song1ref620
+	.byte $ff, $18
+	.word @song1ref620
+	.byte $ff, $18
+	.word @song1ref620
+	.byte $ff, $18
+	.word @song1ref620
+	.byte $ff, $15
+	.word @song1ref620
+	.byte $fd
+	.word @song1ch4loop
+@song2ch0:
+	.byte $fb, $01
+@song2ch0loop:
+	.byte $8c, $5c
+@song2ref6:
+	.byte $9b, $3a, $9b, $3a, $9b, $3a, $9b, $3a, $9b, $3a, $9b, $40, $9b, $3c, $9b, $36, $9b, $3a, $9b, $32, $9b, $30, $ff, $0b
+	.word @song2ref6
+	.byte $3a, $9b, $36, $9b, $32, $9b, $2c, $9b, $32, $9b, $30, $b9, $3a, $ff, $16
+	.word @song2ref6
+	.byte $9b, $3a, $9b, $3a, $9b, $3a, $9b, $3c, $9b, $3c, $9b, $3c, $9b, $40, $9b, $40, $9b, $40
+@song2ref65:
+	.byte $9b, $44, $9b, $44, $9b, $44, $9b, $48, $9b, $48, $9b, $48, $9b, $4a, $9b, $4a, $9b, $4a
+@song2ref83:
+	.byte $9b, $4e, $9b, $4a, $9b, $48, $9b, $4a, $9b, $48, $9b, $44, $ff, $0c
+	.word @song2ref83
+	.byte $9b, $58, $9b, $54, $9b, $52, $9b, $54, $9b, $52, $9b, $4e, $9b, $4e, $9b, $4a, $9b, $48, $9b, $48, $8d, $44, $8b, $40
+	.byte $8d, $3c, $8b, $3a, $8d, $36, $8b, $44, $d7, $52, $d7, $52, $f9, $b7, $58, $b9, $54, $b9, $4e, $b9, $52, $b9, $4a, $b9
+	.byte $48, $b9, $44, $d7, $4e, $d7, $4a, $d7, $48, $d7, $3c, $8d, $40, $8b, $44, $8d, $48, $8b, $40, $8d, $44, $8b, $48, $8d
+	.byte $4a, $8b, $44, $8d, $48, $8b, $4a, $8d, $4e, $8b, $48, $8d, $4a, $8b, $4e, $8d, $52, $8b, $4a, $8d, $4e, $8b, $52, $8d
+	.byte $54, $8b, $4e, $8d, $52, $8b, $54, $8d, $58
+@song2ref203:
+	.byte $8b, $5c, $8d, $52, $8b, $54, $8d, $5a, $8b, $5c, $8d, $52, $8b, $54, $8d, $5a, $ff, $10
+	.word @song2ref203
+	.byte $ff, $10
+	.word @song2ref203
+	.byte $8b, $5c, $8d, $54, $8b, $5a, $8d, $5c, $8b, $60, $8d, $5a, $8b, $5c, $8d, $60, $8b, $62, $8d, $5c, $8b, $60, $8d, $62
+	.byte $8b, $66, $8d, $60, $8b, $62, $8d, $66, $8b, $6a, $8d, $66, $8b, $6a, $8d, $6c, $8b, $70, $8d, $6a, $8b, $6c, $8d, $70
+	.byte $8b, $74, $d7, $4e, $d7, $4a, $d7, $48
+@song2ref281:
+	.byte $d7
+@song2ref282:
+	.byte $5c, $9b, $5c, $9b, $44, $9b, $5c, $9b, $44, $9b, $44, $9b, $ff, $0c
+	.word @song2ref282
+	.byte $5c, $d7, $66, $d7, $62, $d7, $60, $ff, $0d
+	.word @song2ref281
+	.byte $ff, $0c
+	.word @song2ref282
+	.byte $44, $d7, $4e, $d7, $4a, $d7, $48, $d7, $30, $d7, $3a, $d7, $36, $d7, $30, $d7, $4c, $d7, $56, $d7, $52, $d7, $50, $d7
+	.byte $52, $9b, $44, $9b, $44, $ff, $13
+	.word @song2ref65
+	.byte $fd
+	.word @song2ch0loop
+@song2ch1:
+@song2ch1loop:
+	.byte $8e, $0c
+@song2ref348:
+	.byte $9b
+@song2ref349:
+	.byte $2c, $9b, $2c, $9b, $2c, $9b, $2c, $9b, $2c, $9b, $2c, $ff, $0c
+	.word @song2ref348
+	.byte $ff, $0b
+	.word @song2ref348
+	.byte $24, $9b, $24, $9b, $24, $9b, $24, $d7, $ff, $0b
+	.word @song2ref349
+	.byte $ff, $0c
+	.word @song2ref348
+	.byte $ff, $0c
+	.word @song2ref348
+	.byte $9b, $30, $9b, $30, $9b, $30, $9b, $30, $9b, $30, $9b, $30, $ff, $0c
+	.word @song2ref348
+	.byte $ff, $0c
+	.word @song2ref348
+	.byte $ff, $0c
+	.word @song2ref348
+	.byte $9b, $24, $9b, $24, $9b, $24, $9b, $24, $9b, $24, $9b, $24, $9b, $16, $f9, $b7, $2c, $ff, $15
+	.word @song2ref6
+	.byte $2c, $ff, $0b
+	.word @song2ref6
+	.byte $3a, $ff, $0b
+	.word @song2ref6
+	.byte $3a, $9b, $32, $9b, $32, $9b, $32, $9b, $32, $9b, $32, $9b, $32, $9b, $3a, $9b, $36, $9b, $30, $9b, $32, $9b, $2c, $9b
+	.byte $30, $ff, $0c
+	.word @song2ref348
+	.byte $9b, $30, $9b, $30, $9b, $30, $9b, $32, $9b, $30, $9b, $30, $9b, $2c, $d7, $3a, $d7, $3a, $b9, $22, $b9, $1a, $b9, $28
+	.byte $ab, $24, $a9, $18, $9b, $1e, $9b, $18, $9b, $22, $9b, $18, $9b, $1e, $9b, $22, $9b, $24, $9b, $28, $9b, $24, $9b, $14
+	.byte $9b, $14, $9b, $1e, $9b, $14, $9b, $14, $9b, $1a, $9b, $10, $9b, $10, $9b, $18, $9b, $10, $9b, $10
+@song2ref528:
+	.byte $9b, $0a, $9b, $0a, $9b, $0a, $9b, $0a, $9b, $0a, $9b, $0a, $9b
+@song2ref541:
+	.byte $08, $9b, $08, $9b, $08, $9b, $08, $9b, $08, $9b, $08, $9b, $1e, $9b, $1e, $9b, $1e, $9b, $1e, $9b, $1e, $9b, $1e, $9b
+	.byte $18, $9b, $18, $9b, $18, $9b, $1a, $9b, $1a, $9b, $1a, $ff, $19
+	.word @song2ref528
+	.byte $26, $9b, $1e, $9b, $1e, $9b, $28, $9b, $1e, $9b, $1e, $9b, $24, $9b, $18, $9b, $18, $9b, $24, $9b, $1a, $9b, $1a, $9b
+	.byte $2a, $9b, $12, $9b, $12, $9b, $2a, $9b, $12, $9b, $12, $9b, $28, $9b, $10, $9b, $10, $9b, $28, $9b, $10, $9b, $10, $9b
+	.byte $2e, $9b, $16, $9b, $16, $9b, $2e, $9b, $16, $9b, $16, $9b, $2c, $9b, $14, $9b, $14, $9b, $2c, $9b, $14, $9b, $14, $9b
+	.byte $0c, $9b, $0c, $9b, $0c, $b9
+@song2ref657:
+	.byte $0c, $9b, $0c, $9b, $0c, $9b, $0c, $9b, $0c, $9b, $0c, $9b, $0c, $9b, $0c, $9b, $fd
+	.word @song2ch1loop
+@song2ch2:
+@song2ch2loop:
+@song2ref677:
+	.byte $f9, $b9, $f9, $b9, $f9, $b9, $f9, $b9, $f9, $b9, $f9, $b9, $f9, $b9, $84
+@song2ref692:
+	.byte $10, $9b, $10, $9b, $10, $9b, $10, $9b, $10, $9b, $10, $9b, $ff, $0c
+	.word @song2ref692
+	.byte $ff, $0c
+	.word @song2ref541
+@song2ref710:
+	.byte $06
+@song2ref711:
+	.byte $9b, $06, $9b, $06, $9b, $06, $9b, $06, $9b, $06, $9b, $ff, $0c
+	.word @song2ref710
+	.byte $02, $f9, $b7, $0c
+@song2ref729:
+	.byte $9b, $14, $9b, $14, $9b, $14, $9b, $14, $9b, $14, $9b, $14, $ff, $0c
+	.word @song2ref729
+	.byte $ff, $0c
+	.word @song2ref729
+	.byte $ff, $0b
+	.word @song2ref729
+	.byte $ff, $10
+	.word @song2ref657
+	.byte $0c, $9b, $0c, $9b, $0c, $9b, $0c, $ff, $0b
+	.word @song2ref711
+	.byte $06, $ff, $0d
+	.word @song2ref528
+@song2ref767:
+	.byte $00, $f9, $b7, $f9, $b9, $f9, $b9, $f9, $b9, $f9, $b9, $f9, $b9
+@song2ref780:
+	.byte $22, $9b, $22, $9b, $00, $9b, $22, $9b, $00, $b9, $20, $9b, $20, $9b, $00, $9b, $20, $9b, $00, $b9, $0e, $9b, $0e, $9b
+	.byte $0e, $9b, $0e, $9b, $0e, $9b, $0e, $ff, $0d
+	.word @song2ref528
+	.byte $ff, $1f
+	.word @song2ref780
+	.byte $ff, $0d
+	.word @song2ref528
+	.byte $ff, $0d
+	.word @song2ref767
+	.byte $fd
+	.word @song2ch2loop
+@song2ch3:
+@song2ch3loop:
+	.byte $ff, $0e
+	.word @song2ref677
+	.byte $ff, $0e
+	.word @song2ref677
+	.byte $ff, $0e
+	.word @song2ref677
+	.byte $ff, $0e
+	.word @song2ref677
+	.byte $ff, $0e
+	.word @song2ref677
+	.byte $ff, $0c
+	.word @song2ref677
+	.byte $fd
+	.word @song2ch3loop
+@song2ch4:
+@song2ch4loop:
+	.byte $ff, $0e
+	.word @song2ref677
+	.byte $ff, $0e
+	.word @song2ref677
+	.byte $ff, $0e
+	.word @song2ref677
+	.byte $ff, $0e
+	.word @song2ref677
+	.byte $ff, $0e
+	.word @song2ref677
+	.byte $ff, $0c
+	.word @song2ref677
+	.byte $fd
+	.word @song2ch4loop
+
+.segment "DPCM"		;DMC sample area in the fixed bank, see FT_DPCM_OFF in famitone2.s
+
+	.align 64
+dpcm_impact:
+	.byte $7f,$b7,$34,$ed,$66,$97,$e1,$66,$c8,$87,$4b,$1c,$d4,$94,$98,$cc
+	.byte $64,$08,$16,$b5,$e7,$96,$5b,$8e,$97,$e7,$65,$9e,$aa,$a8,$2e,$67
+	.byte $6e,$61,$81,$e1,$19,$60,$dc,$0b,$3c,$14,$da,$4a,$d5,$b6,$2b,$bd
+	.byte $97,$17,$d2,$13,$55,$f8,$2d,$82,$87,$9d,$20,$ad,$85,$6a,$54,$99
+	.byte $1d,$8f,$9a,$e9,$99,$8f,$98,$d1,$f3,$a9,$5c,$f0,$18,$33,$ab,$48
+	.byte $bb,$4c,$71,$58,$d8,$cc,$24,$dd,$b2,$5b,$ac,$78,$62,$ae,$39,$b6
+	.byte $c6,$45,$d3,$cc,$a9,$46,$2b,$71,$78,$94,$86,$56,$5a,$71,$9a,$a6
+	.byte $47,$97,$55,$ce,$5c,$d9,$5a,$ca,$51,$33,$2b,$95,$3a,$93,$99,$4a
+	.byte $59,$ac,$25,$56,$e5,$54,$cb,$cc,$9a,$59,$55,$73,$6c,$4d,$66,$65
+	.byte $a6,$a9,$aa,$c5,$b1,$54,$55,$6a,$a9,$2c,$4d,$cd,$54,$4b,$9b,$b2
+	.byte $66,$69,$55,$ad,$c6,$aa,$a5,$a9,$aa,$aa,$32,$35,$95,$a9,$a9,$aa
+	.byte $aa,$32,$4b,$4b,$cd,$aa,$aa,$a9,$59,$55,$cb,$b2,$ac,$aa,$aa,$d2
+	.byte $d2,$52,$55,$55,$96,$aa,$aa,$b2,$aa,$32,$b5,$ac,$aa,$6a,$65,$55
+	.byte $55,$55,$35,$b5,$aa,$ca,$d2,$4c,$55,$55,$55,$95,$a9,$aa,$aa,$aa
+	.byte $aa,$aa,$aa,$aa,$aa,$6a,$59,$55,$55,$55,$55,$4d,$4d,$55,$55,$55
+	.byte $55,$55,$a9,$aa,$aa,$aa,$aa,$aa,$aa,$aa,$aa,$aa,$6a,$55,$55,$55
+	.byte $55,$55,$55,$55,$55,$55,$55,$55,$55,$a6,$aa,$aa,$aa,$aa,$aa,$aa
+	.byte $aa,$aa,$aa,$aa,$56,$55,$55,$55,$55,$55,$55,$55,$55,$55,$55,$95
+	.byte $a9,$aa,$aa,$aa,$aa,$aa,$aa,$aa,$aa,$aa,$6a,$56,$55,$55,$55,$55
+	.byte $55,$55,$55,$55,$55,$55,$55,$a9,$aa,$aa,$aa,$aa,$aa,$aa,$aa,$aa
+	.byte $aa
+
+	.align 64
+dpcm_thud:
+	.byte $7f,$b7,$b4,$7d,$66,$95,$55,$56,$cc,$85,$4a,$0c,$94,$90,$98,$44
+	.byte $64,$88,$16,$9d,$a7,$9a,$5b,$ae,$97,$e7,$75,$9e,$ae,$b9,$ae,$65
+	.byte $67,$69,$a9,$a9,$58,$32,$46,$29,$26,$92,$4a,$4a,$52,$26,$a9,$2a
+	.byte $55,$95,$56,$55,$6d,$d6,$6a,$ad,$d5,$d6,$5a,$ad,$ad,$d6,$6a,$d5
+	.byte $aa,$55,$55,$55,$55,$a5,$aa,$54,$aa,$94,$4a,$a9,$94,$4a,$a5,$52
+	.byte $a9,$52,$a5,$aa,$4a,$55,$55,$d5,$aa,$aa,$56,$ad,$6a,$d5,$6a,$b5
+	.byte $6a,$b5,$6a,$d5,$aa,$56,$b5,$aa,$aa,$56,$55,$55,$a9,$aa,$aa,$54
+	.byte $55,$aa,$52,$95,$2a,$55,$a9,$52,$95,$aa,$52,$55,$a9,$aa,$aa,$4a
+	.byte $55,$55,$b5,$aa,$aa,$aa,$55,$55,$ab,$aa,$55,$b5,$aa,$56,$d5,$aa
+	.byte $6a,$55,$d5,$aa,$aa,$aa,$5a,$55,$55,$55,$55,$aa,$aa,$aa,$2a,$55
+	.byte $55,$a9,$aa,$4a,$55,$a5,$aa,$2a,$55,$55,$a9,$aa,$aa,$2a,$55,$55
+	.byte $55,$55,$55,$55,$55,$d5,$aa,$aa,$aa,$5a,$55,$55,$ad,$aa,$aa,$56
+	.byte $55,$55,$ab,$aa,$aa,$5a,$55,$55,$55,$55,$55,$55,$55,$55,$55,$55
+	.byte $55,$55,$a9,$aa,$aa,$aa,$52,$55,$55,$95,$aa,$aa,$aa,$4a,$55,$55
+	.byte $55,$55,$55,$a9,$aa,$aa,$aa,$aa,$aa,$aa,$5a,$55,$55,$55,$55,$55
+	.byte $b5,$aa,$aa,$aa,$aa,$56,$55,$55,$55,$55,$ab,$aa,$aa,$aa,$aa,$aa
+	.byte $aa,$aa,$aa,$aa,$aa,$aa,$aa,$aa,$aa,$aa,$aa,$54,$55,$55,$55,$55
+	.byte $55,$a9,$aa,$aa,$aa,$aa,$aa,$aa,$54,$55,$55,$55,$55,$55,$55,$55
+	.byte $55,$55,$55,$55,$55,$b5,$aa,$aa,$aa,$aa,$aa,$aa,$aa,$6a,$55,$55
+	.byte $55
@@ -1,9 +1,11 @@
-const unsigned char nametable_death[101]={
-0x01,0x00,0x01,0x1f,0x7a,0x01,0x1f,0x00,0x01,0x8b,0x61,0x62,0x63,0x64,0x65,0x66,
-0x67,0x68,0x00,0x01,0x16,0x70,0x71,0x72,0x73,0x74,0x75,0x76,0x77,0x78,0x79,0x00,
-0x01,0x36,0x59,0x4f,0x55,0x00,0x44,0x49,0x45,0x44,0x00,0x01,0x37,0x7a,0x7a,0x00,
-0x64,0x65,0x00,0x7a,0x7a,0x00,0x01,0x1a,0x74,0x75,0x00,0x01,0x99,0x50,0x52,0x45,
-0x53,0x53,0x00,0x53,0x54,0x41,0x52,0x54,0x00,0x01,0xfe,0x00,0x01,0x9c,0x88,0x0a,
-0x0a,0xa0,0x00,0x01,0x03,0x08,0x00,0x00,0x02,0x00,0x01,0x03,0x0a,0x01,0x03,0x00,
-0x01,0x18,0x00,0x01,0x00
-};
+// Generated by tools/build_assets.py from assets/nam/death.nam, do not edit
+
+const unsigned char nametable_death[100]={
+0x01,0x00,0x01,0x1f,0x7a,0x01,0x1f,0x00,0x01,0x8b,0x61,0x62,0x63,0x64,0x65,0x66,
+0x67,0x68,0x00,0x01,0x16,0x70,0x71,0x72,0x73,0x74,0x75,0x76,0x77,0x78,0x79,0x00,
+0x01,0x36,0x59,0x4f,0x55,0x00,0x44,0x49,0x45,0x44,0x00,0x01,0x37,0x7a,0x7a,0x00,
+0x64,0x65,0x00,0x7a,0x7a,0x00,0x01,0x1a,0x74,0x75,0x00,0x01,0x99,0x50,0x52,0x45,
+0x53,0x53,0x00,0x53,0x54,0x41,0x52,0x54,0x00,0x01,0xff,0x00,0x01,0x9b,0x88,0x0a,
+0x0a,0xa0,0x00,0x01,0x03,0x08,0x00,0x00,0x02,0x00,0x01,0x03,0x0a,0x01,0x03,0x00,
+0x01,0x19,0x01,0x00
+};
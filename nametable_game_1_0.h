@@ -1,3 +1,19 @@
+// Generated by tools/build_assets.py from assets/nam/game_1_0.nam, do not edit
+
+// RLE on the banked builds (decoded into the WRAM room cache), raw on NROM
+#if MAPPER_BANKED
+const unsigned char nametable_game_1_0[141]={
+0x01,0x00,0x01,0x99,0xc9,0x00,0x01,0x2f,0x86,0x00,0x00,0x86,0x01,0x03,0x00,0x01,
+0x16,0x86,0x01,0x09,0x00,0x01,0xc3,0x91,0x92,0x92,0x93,0x00,0x01,0x53,0x91,0x92,
+0x93,0x00,0x01,0x65,0xac,0x01,0x02,0x00,0x01,0x0c,0x91,0x92,0x92,0x93,0x00,0x01,
+0x24,0xac,0x01,0x06,0x00,0x01,0x18,0xe0,0xe1,0x00,0xe2,0xe3,0x00,0x01,0x1a,0xf0,
+0xf1,0x00,0xf2,0xf3,0x00,0x00,0xf5,0xf4,0xf5,0xf6,0x00,0x01,0x03,0x92,0x01,0x1f,
+0xa2,0x01,0x1f,0x02,0x01,0x7f,0xaa,0xaa,0xa2,0xa0,0x01,0x03,0x00,0xaa,0x01,0x02,
+0x6a,0x9a,0xaa,0xa2,0x00,0xaa,0xaa,0x2a,0x0a,0x0a,0x2a,0x22,0x00,0xaa,0xaa,0x2a,
+0xaa,0x19,0x26,0x25,0x08,0xaa,0xaa,0xa8,0xa6,0x09,0x0a,0xaa,0x08,0x09,0x02,0xa5,
+0xaa,0xaa,0x2a,0xa2,0x00,0x55,0x01,0x07,0x05,0x01,0x07,0x01,0x00
+};
+#else
 const unsigned char nametable_game_1_0[1024]={
 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
@@ -64,3 +80,4 @@ const unsigned char nametable_game_1_0[1024]={
 0xaa,0xaa,0xa8,0xa6,0x09,0x0a,0xaa,0x08,0x09,0x02,0xa5,0xaa,0xaa,0x2a,0xa2,0x00,
 0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05
 };
+#endif
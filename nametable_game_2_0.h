@@ -1,3 +1,19 @@
+// Generated by tools/build_assets.py from assets/nam/game_2_0.nam, do not edit
+
+// RLE on the banked builds (decoded into the WRAM room cache), raw on NROM
+#if MAPPER_BANKED
+const unsigned char nametable_game_2_0[142]={
+0x01,0x00,0x01,0x99,0xc9,0x00,0x01,0x2f,0x86,0x00,0x00,0x86,0x01,0x03,0x00,0x01,
+0x16,0x86,0x01,0x09,0x00,0x01,0xff,0x00,0x01,0x84,0xac,0x01,0x02,0x00,0x01,0x38,
+0xac,0xac,0x00,0x01,0x49,0x92,0x01,0x05,0x93,0xf8,0x01,0x02,0x91,0x92,0x01,0x02,
+0x93,0xf8,0x01,0x03,0x91,0x92,0x92,0x93,0xf8,0x01,0x03,0x91,0x92,0x01,0x03,0xa2,
+0x01,0x06,0x92,0x01,0x02,0xa2,0x01,0x04,0x92,0x01,0x03,0xa2,0x01,0x03,0x92,0x01,
+0x03,0xa2,0x01,0x04,0x02,0x01,0x7f,0xaa,0xaa,0xa2,0xa0,0x01,0x03,0x00,0xaa,0x01,
+0x02,0x6a,0x9a,0xaa,0xa2,0x00,0xaa,0xaa,0x2a,0x0a,0x0a,0x2a,0x22,0x00,0xaa,0xaa,
+0x2a,0xaa,0x59,0x56,0x65,0x08,0xaa,0xaa,0x58,0x95,0x05,0x0a,0xaa,0x08,0x09,0x02,
+0x95,0x65,0x55,0x56,0x51,0x10,0x55,0x01,0x07,0x05,0x01,0x07,0x01,0x00
+};
+#else
 const unsigned char nametable_game_2_0[1024]={
 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
@@ -64,3 +80,4 @@ const unsigned char nametable_game_2_0[1024]={
 0xaa,0xaa,0x58,0x95,0x05,0x0a,0xaa,0x08,0x09,0x02,0x95,0x65,0x55,0x56,0x51,0x10,
 0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05
 };
+#endif
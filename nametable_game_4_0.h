@@ -1,66 +1,94 @@
+// Generated by tools/build_assets.py from assets/nam/game_4_0.nam, do not edit
+
+// RLE on the banked builds (decoded into the WRAM room cache), raw on NROM
+#if MAPPER_BANKED
+const unsigned char nametable_game_4_0[316]={
+0x01,0x00,0x01,0x1e,0xa1,0x00,0x01,0x1e,0xa1,0x00,0x01,0x1e,0xa1,0x00,0x01,0x1e,
+0xa1,0x00,0x01,0x19,0xc9,0x00,0x01,0x03,0xa1,0x00,0x01,0x1e,0xa1,0x00,0x01,0x0a,
+0x86,0x00,0x00,0x86,0x01,0x03,0x00,0x01,0x0c,0xa1,0x00,0x01,0x08,0x86,0x01,0x09,
+0x00,0x01,0x0b,0xa1,0x00,0x01,0x1e,0xa1,0x00,0x01,0x1e,0xa1,0x00,0x01,0x1e,0xa1,
+0x00,0x01,0x1e,0xa1,0x00,0x01,0x1e,0xa1,0x00,0x01,0x1e,0xa1,0x00,0x01,0x1e,0xa1,
+0x00,0x01,0x11,0xdc,0xdd,0xcc,0x01,0x02,0xbd,0xbe,0x00,0x01,0x05,0xa1,0x00,0x01,
+0x11,0xec,0xed,0x00,0x01,0x02,0xcd,0xce,0x00,0x01,0x05,0xa1,0x00,0x01,0x11,0xde,
+0x00,0x01,0x04,0xde,0x00,0x01,0x05,0xa1,0x00,0x01,0x11,0xde,0x00,0x01,0x04,0xde,
+0x00,0x01,0x05,0xa1,0x00,0x01,0x11,0xde,0x00,0x01,0x04,0xde,0xac,0xac,0x00,0x01,
+0x03,0xa1,0x00,0x01,0x11,0xde,0x00,0x01,0x04,0xde,0x00,0x01,0x05,0xa1,0x00,0x01,
+0x11,0xde,0x00,0xac,0xac,0x00,0x00,0xde,0x00,0x01,0x05,0xa1,0x00,0x01,0x11,0xee,
+0xbc,0x01,0x04,0xee,0x00,0x01,0x05,0xa1,0x00,0x01,0x11,0xfe,0xfc,0x01,0x04,0xfe,
+0x00,0x01,0x05,0xa1,0x92,0x01,0x12,0x93,0x04,0x01,0x02,0x91,0x92,0x01,0x06,0xa2,
+0x01,0x13,0xa3,0x04,0x01,0x02,0xa1,0xa2,0x01,0x07,0x02,0x01,0x11,0xa2,0xa3,0x04,
+0x01,0x02,0xa1,0xa2,0x02,0x01,0x18,0xa2,0xa3,0x04,0x01,0x02,0xa1,0xa2,0x02,0x01,
+0x18,0xa2,0xa3,0x04,0x01,0x02,0xa1,0xa2,0x02,0x01,0x18,0xa2,0xa3,0x04,0x01,0x02,
+0xa1,0xa2,0x02,0x01,0x06,0xaa,0xaa,0xa2,0xa0,0x01,0x03,0x44,0xaa,0x01,0x02,0x6a,
+0x9a,0xaa,0xa2,0x44,0xaa,0xaa,0x2a,0x0a,0x0a,0x2a,0x22,0x44,0xaa,0xaa,0x2a,0x6a,
+0x59,0x56,0x55,0x44,0xaa,0xaa,0x58,0x55,0x45,0x06,0x99,0x44,0x09,0x02,0x95,0x55,
+0x55,0x56,0x51,0x54,0x55,0x01,0x07,0x05,0x01,0x07,0x01,0x00
+};
+#else
 const unsigned char nametable_game_4_0[1024]={
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa1,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa1,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa1,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa1,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc9,0x00,0x00,0x00,0x00,0xa1,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa1,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x86,0x00,0x00,0x86,0x86,
-0x86,0x86,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa1,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x86,0x86,0x86,0x86,0x86,0x86,0x86,
-0x86,0x86,0x86,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa1,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa1,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa1,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa1,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa1,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa1,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa1,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa1,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0xdc,0xdd,0xcc,0xcc,0xcc,0xbd,0xbe,0x00,0x00,0x00,0x00,0x00,0x00,0xa1,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0xec,0xed,0x00,0x00,0x00,0xcd,0xce,0x00,0x00,0x00,0x00,0x00,0x00,0xa1,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0xde,0x00,0x00,0x00,0x00,0x00,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0xa1,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0xde,0x00,0x00,0x00,0x00,0x00,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0xa1,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0xde,0x00,0x00,0x00,0x00,0x00,0xde,0xac,0xac,0x00,0x00,0x00,0x00,0xa1,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0xde,0x00,0x00,0x00,0x00,0x00,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0xa1,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0xde,0x00,0xac,0xac,0x00,0x00,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0xa1,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0xee,0xbc,0xbc,0xbc,0xbc,0xbc,0xee,0x00,0x00,0x00,0x00,0x00,0x00,0xa1,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0xfe,0xfc,0xfc,0xfc,0xfc,0xfc,0xfe,0x00,0x00,0x00,0x00,0x00,0x00,0xa1,
-0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x92,
-0x92,0x92,0x92,0x93,0x04,0x04,0x04,0x91,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0xa2,
-0xa2,0xa2,0xa2,0xa2,0xa2,0xa2,0xa2,0xa2,0xa2,0xa2,0xa2,0xa2,0xa2,0xa2,0xa2,0xa2,
-0xa2,0xa2,0xa2,0xa3,0x04,0x04,0x04,0xa1,0xa2,0xa2,0xa2,0xa2,0xa2,0xa2,0xa2,0xa2,
-0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,
-0x02,0x02,0xa2,0xa3,0x04,0x04,0x04,0xa1,0xa2,0x02,0x02,0x02,0x02,0x02,0x02,0x02,
-0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,
-0x02,0x02,0xa2,0xa3,0x04,0x04,0x04,0xa1,0xa2,0x02,0x02,0x02,0x02,0x02,0x02,0x02,
-0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,
-0x02,0x02,0xa2,0xa3,0x04,0x04,0x04,0xa1,0xa2,0x02,0x02,0x02,0x02,0x02,0x02,0x02,
-0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,
-0x02,0x02,0xa2,0xa3,0x04,0x04,0x04,0xa1,0xa2,0x02,0x02,0x02,0x02,0x02,0x02,0x02,
-0xaa,0xaa,0xa2,0xa0,0xa0,0xa0,0xa0,0x44,0xaa,0xaa,0xaa,0x6a,0x9a,0xaa,0xa2,0x44,
-0xaa,0xaa,0x2a,0x0a,0x0a,0x2a,0x22,0x44,0xaa,0xaa,0x2a,0x6a,0x59,0x56,0x55,0x44,
-0xaa,0xaa,0x58,0x55,0x45,0x06,0x99,0x44,0x09,0x02,0x95,0x55,0x55,0x56,0x51,0x54,
-0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05
-};
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa1,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa1,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa1,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa1,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc9,0x00,0x00,0x00,0x00,0xa1,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa1,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x86,0x00,0x00,0x86,0x86,
+0x86,0x86,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa1,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x86,0x86,0x86,0x86,0x86,0x86,0x86,
+0x86,0x86,0x86,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa1,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa1,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa1,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa1,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa1,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa1,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa1,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa1,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0xdc,0xdd,0xcc,0xcc,0xcc,0xbd,0xbe,0x00,0x00,0x00,0x00,0x00,0x00,0xa1,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0xec,0xed,0x00,0x00,0x00,0xcd,0xce,0x00,0x00,0x00,0x00,0x00,0x00,0xa1,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0xde,0x00,0x00,0x00,0x00,0x00,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0xa1,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0xde,0x00,0x00,0x00,0x00,0x00,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0xa1,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0xde,0x00,0x00,0x00,0x00,0x00,0xde,0xac,0xac,0x00,0x00,0x00,0x00,0xa1,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0xde,0x00,0x00,0x00,0x00,0x00,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0xa1,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0xde,0x00,0xac,0xac,0x00,0x00,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0xa1,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0xee,0xbc,0xbc,0xbc,0xbc,0xbc,0xee,0x00,0x00,0x00,0x00,0x00,0x00,0xa1,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0xfe,0xfc,0xfc,0xfc,0xfc,0xfc,0xfe,0x00,0x00,0x00,0x00,0x00,0x00,0xa1,
+0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x92,
+0x92,0x92,0x92,0x93,0x04,0x04,0x04,0x91,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0xa2,
+0xa2,0xa2,0xa2,0xa2,0xa2,0xa2,0xa2,0xa2,0xa2,0xa2,0xa2,0xa2,0xa2,0xa2,0xa2,0xa2,
+0xa2,0xa2,0xa2,0xa3,0x04,0x04,0x04,0xa1,0xa2,0xa2,0xa2,0xa2,0xa2,0xa2,0xa2,0xa2,
+0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,
+0x02,0x02,0xa2,0xa3,0x04,0x04,0x04,0xa1,0xa2,0x02,0x02,0x02,0x02,0x02,0x02,0x02,
+0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,
+0x02,0x02,0xa2,0xa3,0x04,0x04,0x04,0xa1,0xa2,0x02,0x02,0x02,0x02,0x02,0x02,0x02,
+0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,
+0x02,0x02,0xa2,0xa3,0x04,0x04,0x04,0xa1,0xa2,0x02,0x02,0x02,0x02,0x02,0x02,0x02,
+0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,
+0x02,0x02,0xa2,0xa3,0x04,0x04,0x04,0xa1,0xa2,0x02,0x02,0x02,0x02,0x02,0x02,0x02,
+0xaa,0xaa,0xa2,0xa0,0xa0,0xa0,0xa0,0x44,0xaa,0xaa,0xaa,0x6a,0x9a,0xaa,0xa2,0x44,
+0xaa,0xaa,0x2a,0x0a,0x0a,0x2a,0x22,0x44,0xaa,0xaa,0x2a,0x6a,0x59,0x56,0x55,0x44,
+0xaa,0xaa,0x58,0x55,0x45,0x06,0x99,0x44,0x09,0x02,0x95,0x55,0x55,0x56,0x51,0x54,
+0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05
+};
+#endif
@@ -1,9 +1,11 @@
-const unsigned char nametable_menu[109]={
-0x01,0x00,0x01,0x1f,0x7a,0x01,0x1f,0x00,0x01,0x8b,0x61,0x62,0x63,0x64,0x65,0x66,
-0x67,0x68,0x00,0x01,0x16,0x70,0x71,0x72,0x73,0x74,0x75,0x76,0x77,0x78,0x79,0x00,
-0x01,0x35,0x48,0x4f,0x4c,0x4c,0x4f,0x57,0x00,0x4e,0x45,0x53,0x00,0x01,0x35,0x7a,
-0x01,0x02,0x00,0x64,0x65,0x00,0x7a,0x01,0x02,0x00,0x01,0x19,0x74,0x75,0x00,0x01,
-0x99,0x50,0x52,0x45,0x53,0x53,0x00,0x53,0x54,0x41,0x52,0x54,0x00,0x01,0xb6,0x40,
-0x55,0x46,0x41,0x42,0x43,0x00,0x01,0xde,0x08,0x0a,0x0a,0x02,0x00,0x01,0x0b,0x0a,
-0x01,0x03,0x00,0x01,0x04,0xa0,0xa0,0x00,0x01,0x11,0x00,0x01,0x00
-};
+// Generated by tools/build_assets.py from assets/nam/menu.nam, do not edit
+
+const unsigned char nametable_menu[108]={
+0x01,0x00,0x01,0x1f,0x7a,0x01,0x1f,0x00,0x01,0x8b,0x61,0x62,0x63,0x64,0x65,0x66,
+0x67,0x68,0x00,0x01,0x16,0x70,0x71,0x72,0x73,0x74,0x75,0x76,0x77,0x78,0x79,0x00,
+0x01,0x35,0x48,0x4f,0x4c,0x4c,0x4f,0x57,0x00,0x4e,0x45,0x53,0x00,0x01,0x35,0x7a,
+0x01,0x02,0x00,0x64,0x65,0x00,0x7a,0x01,0x02,0x00,0x01,0x19,0x74,0x75,0x00,0x01,
+0x99,0x50,0x52,0x45,0x53,0x53,0x00,0x53,0x54,0x41,0x52,0x54,0x00,0x01,0xb6,0x40,
+0x55,0x46,0x41,0x42,0x43,0x00,0x01,0xde,0x08,0x0a,0x0a,0x02,0x00,0x01,0x0b,0x0a,
+0x01,0x03,0x00,0x01,0x04,0xa0,0xa0,0x00,0x01,0x12,0x01,0x00
+};
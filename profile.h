@@ -0,0 +1,58 @@
+
+#ifndef _PROFILE_H
+#define _PROFILE_H
+
+#include "input.h"
+
+//------------------------------------------------------------------------------//
+//                        NMI and Frame Timing Markers                          //
+//------------------------------------------------------------------------------//
+
+// NMI_PROFILE builds the game with timing markers for tools/nmi_budget.lua, a
+// headless emulator script that times every frame in CPU cycles:
+//
+//   NMI start -> PROFILE_NMI_PPU     neslib NMI: OAM DMA, update buffer, palette,
+//                                    scroll (must fit in vblank)
+//   PROFILE_NMI_PPU -> _NMI_AUDIO    NMI callback: FamiTone tick, mapper work
+//   PROFILE_LOGIC -> PROFILE_IDLE    main loop game logic
+//
+// A marker is one write to PROFILE_PORT, an unused APU test register that the
+// console ignores, so a profiling build still runs on hardware. profile_vram()
+// reports how many update buffer bytes the next NMI will send. Must match
+// NMI_PROFILE in mapper.inc.
+#ifndef NMI_PROFILE
+#define NMI_PROFILE 0
+#endif
+
+#define PROFILE_NMI_PPU   1
+#define PROFILE_NMI_AUDIO 2
+#define PROFILE_LOGIC     3
+#define PROFILE_IDLE      4
+
+#if NMI_PROFILE
+
+#define PROFILE_PORT ((volatile unsigned char*)0x4018)
+
+#define profile_mark(m)      (PROFILE_PORT[0] = (m))
+#define profile_vram(bytes)  (PROFILE_PORT[1] = (bytes))
+
+// NMI callback: marks the end of the PPU work, runs mapper_nmi_update (through
+// input_nmi_update in INPUT_NMI_LATCH builds), marks its end
+void __fastcall__ profile_nmi_update(void);
+
+#define NMI_CALLBACK profile_nmi_update
+
+#else
+
+#define profile_mark(m)
+#define profile_vram(bytes)
+
+#if INPUT_NMI_LATCH
+#define NMI_CALLBACK input_nmi_update
+#else
+#define NMI_CALLBACK mapper_nmi_update
+#endif
+
+#endif
+
+#endif // profile.h
@@ -0,0 +1,46 @@
+
+;------------------------------------------------------------------------------;
+;              NMI timing markers for tools/nmi_budget.lua                     ;
+;------------------------------------------------------------------------------;
+
+; NMI callback of the NMI_PROFILE build, see profile.h. neslib calls it once
+; the OAM DMA, the update buffer and the scroll are done, so the two markers
+; split the NMI into its PPU part and its audio part (the pad read of an
+; INPUT_NMI_LATCH build counts as audio).
+
+	.include "mapper.inc"
+
+.if(NMI_PROFILE)
+
+	.export _profile_nmi_update
+
+.if(NES_INPUT_LATCH)
+	.import _input_nmi_update
+NMI_UPDATE = _input_nmi_update
+.elseif(NES_MAPPER <> 0 .or NES_AUDIO_MAIN_LOOP)
+	.import _mapper_nmi_update
+NMI_UPDATE = _mapper_nmi_update
+.else
+	.import _famitone_update
+NMI_UPDATE = _famitone_update
+.endif
+
+PROFILE_PORT	= $4018		;must match profile.h
+
+PROFILE_NMI_PPU	= 1
+PROFILE_NMI_AUDIO = 2
+
+.segment "CODE"
+
+;void __fastcall__ profile_nmi_update(void);
+
+_profile_nmi_update:
+
+	lda #PROFILE_NMI_PPU
+	sta PROFILE_PORT
+	jsr NMI_UPDATE
+	lda #PROFILE_NMI_AUDIO
+	sta PROFILE_PORT
+	rts
+
+.endif
@@ -1,2 +1,9 @@
+	.include "mapper.inc"
+
+.if(.not NES_CHR_RAM)
 .segment "CHARS"
-.incbin "game_tileset_1.chr"
\ No newline at end of file
+.incbin "game_tileset_1.chr"
+.if(NES_MAPPER = 4)
+.incbin "assets/chr/chr_anim.chr"	;banks 8-15, tile animation frames (chr_anims[])
+.endif
+.endif
@@ -0,0 +1,121 @@
+#!/usr/bin/env python3
+#------------------------------------------------------------------------------//
+#        build_assets.py - Regenerate the nametable headers from sources       //
+#------------------------------------------------------------------------------//
+
+# Rebuilds every nametable header hollow_nes.c includes from the raw 1024-byte
+# .nam files (NES Screen Tool format: 960 tiles + 64 attribute bytes) listed
+# in assets/nametables.txt, and writes assets/manifest.txt:
+#
+#   - one line per nametable: source, kind, raw and packed size, source hash
+#   - the collision map of every room (classes from collision_properties[]
+#     in hollow_nes.c), so a diff shows what changed in the level layout
+#
+# Edit the .nam sources, never the generated headers. The output only depends
+# on the inputs, so running it twice gives the same files.
+#
+# Usage (from the repository root):
+#   tools/build_assets.py
+
+import hashlib
+import os
+import re
+import sys
+
+sys.dont_write_bytecode = True  # no __pycache__ in tools/
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from chr_pack import rle_pack, rle_unpack  # neslib RLE, same as vram_unrle
+
+LIST = "assets/nametables.txt"
+MANIFEST = "assets/manifest.txt"
+GAME_SOURCE = "hollow_nes.c"
+
+NAM_SIZE = 1024
+COLUMNS = 32
+ROWS = 30
+CLASS_CHARS = ".#^db"  # none, solid, spike, dialogue, bench
+
+
+def read_list():
+    entries = []
+    with open(LIST) as f:
+        for n, line in enumerate(f, 1):
+            line = line.split("#", 1)[0].split()
+            if not line:
+                continue
+            if len(line) != 3 or line[2] not in ("room", "screen"):
+                raise ValueError("%s:%d: expected 'name source room|screen'" % (LIST, n))
+            entries.append(tuple(line))
+    return entries
+
+
+def read_collision_properties():
+    with open(GAME_SOURCE) as f:
+        src = f.read()
+    body = re.search(r"collision_properties\[256\]\s*=\s*\{(.*?)\};", src, re.S).group(1)
+    body = re.sub(r"//[^\n]*", "", body)
+    values = [int(v, 0) for v in re.findall(r"0x[0-9a-fA-F]+|\d+", body)]
+    if len(values) != 256:
+        raise ValueError("%s: collision_properties has %d entries" % (GAME_SOURCE, len(values)))
+    return values
+
+
+def c_array(name, data):
+    lines = ["const unsigned char %s[%d]={" % (name, len(data))]
+    for i in range(0, len(data), 16):
+        chunk = ",".join("0x%02x" % b for b in data[i:i + 16])
+        lines.append(chunk + ("," if i + 16 < len(data) else ""))
+    lines.append("};")
+    return lines
+
+
+def main():
+    props = read_collision_properties()
+    manifest = [
+        "# Generated by tools/build_assets.py from %s, do not edit" % LIST,
+        "#",
+        "# name                 kind    raw  packed  sha1 (first 12)  source",
+    ]
+    maps = []
+
+    for name, source, kind in read_list():
+        with open(source, "rb") as f:
+            nam = f.read()
+        if len(nam) != NAM_SIZE:
+            raise ValueError("%s: %d bytes, expected %d" % (source, len(nam), NAM_SIZE))
+        packed = rle_pack(nam)
+        assert rle_unpack(packed) == nam
+
+        out = ["// Generated by tools/build_assets.py from %s, do not edit" % source, ""]
+        if kind == "room":
+            out += ["// RLE on the banked builds (decoded into the WRAM room cache), raw on NROM",
+                    "#if MAPPER_BANKED"]
+            out += c_array(name, packed)
+            out += ["#else"]
+            out += c_array(name, nam)
+            out += ["#endif"]
+        else:
+            out += c_array(name, packed)
+        with open(name + ".h", "w") as f:
+            f.write("\n".join(out) + "\n")
+
+        manifest.append("%-22s %-6s %5d %7d  %s     %s" % (
+            name, kind, len(nam), len(packed), hashlib.sha1(nam).hexdigest()[:12], source))
+
+        if kind == "room":
+            maps += ["", "[%s]" % name]
+            for y in range(ROWS):
+                row = nam[y * COLUMNS:(y + 1) * COLUMNS]
+                maps.append("".join(CLASS_CHARS[props[t]] if props[t] < len(CLASS_CHARS) else "?" for t in row))
+
+    manifest += ["", "# Collision maps: " + ", ".join(
+        "%s %s" % (c, n) for c, n in zip(CLASS_CHARS, ("none", "solid", "spike", "dialogue", "bench")))]
+    manifest += maps
+
+    with open(MANIFEST, "w") as f:
+        f.write("\n".join(manifest) + "\n")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
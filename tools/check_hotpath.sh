@@ -0,0 +1,58 @@
+#!/bin/sh
+#------------------------------------------------------------------------------//
+#        check_hotpath.sh - No runtime multiply/divide in frame-path code      //
+#------------------------------------------------------------------------------//
+
+# cc65 compiles * / and % on non-constant operands (and some constant ones)
+# into calls to runtime helpers such as tosmulax, tosudiva0, tosmodax or
+# mulax7. Those cost hundreds of cycles each, so the per-frame code must not
+# use them.
+#
+# The script scans the cc65 assembly output and fails if any of those helpers
+# is called from a function that runs every frame. Functions that only run
+# during setup or screen transitions (rendering off) are listed in COLD below.
+#
+# Usage:
+#   tools/check_hotpath.sh                  compile hollow_nes.c with cc65 first
+#   tools/check_hotpath.sh hollow_nes.s     check an existing assembly listing
+
+set -e
+
+# Functions allowed to use the runtime helpers (not called every frame)
+COLD="main setup_graphics setup_audio setup_menu setup_game setup_death \
+initialize_player play_music stop_music fade_in fade_out flash_screen \
+handle_death handle_sitting handle_dialogue load_dialogue_box \
+load_dialogue_page clear_dialogue_page clear_dialogue_box load_hud \
+enter_room load_room_nametable load_new_nametable room_cache_fetch \
+rle_unpack dialogue_next"
+
+if [ -n "$1" ]; then
+  ASM="$1"
+else
+  ASM="${TMPDIR:-/tmp}/hollow_nes_hotpath.s"
+  cc65 -Oirs -t nes -o "$ASM" hollow_nes.c
+fi
+
+awk -v cold="$COLD" '
+  BEGIN {
+    n = split(cold, names, " ")
+    for (i = 1; i <= n; i++) skip["_" names[i]] = 1
+  }
+  # .proc _name: near
+  /^\.proc/ {
+    fn = $2
+    sub(/:.*/, "", fn)
+    next
+  }
+  /^\.endproc/ { fn = ""; next }
+  fn != "" && !(fn in skip) && $1 == "jsr" && $2 ~ /^[a-z0-9]*(mul|div|mod)[a-z0-9]*$/ {
+    printf("%s: %s calls %s\n", FILENAME, substr(fn, 2), $2)
+    bad = 1
+  }
+  END { exit bad }
+' "$ASM" || {
+  echo "check_hotpath: runtime multiply/divide in frame-path code" >&2
+  exit 1
+}
+
+echo "check_hotpath: OK"
@@ -0,0 +1,129 @@
+#!/usr/bin/env python3
+#------------------------------------------------------------------------------//
+#          chr_pack.py - Compress CHR tilesets for the CHR-RAM build           //
+#------------------------------------------------------------------------------//
+
+# Packs 4K pattern tables (256 tiles) from .chr files into RLE streams that
+# chr_stream_* in hollow_nes.c decodes into CHR-RAM. The format is the neslib
+# RLE used for the nametables (vram_unrle):
+#
+#   byte 0      tag, a value that does not occur in the data
+#   b           literal byte
+#   tag, n      repeat the previous byte n more times (n = 1..255)
+#   tag, 0      end of stream
+#
+# Usage:
+#   tools/chr_pack.py OUT.s NAME=FILE.chr[@OFFSET][:banked] ...
+#
+# Each NAME becomes an exported label _NAME in segment TILESETS. OFFSET picks
+# the 4K half of the file ($0000 background, $1000 sprites), default 0.
+# :banked leaves the tileset out of the NROM build, which has no room for
+# it; hollow_nes.c then uses the first tileset in its place.
+#
+# Example (what chr_tilesets.s was generated with):
+#   tools/chr_pack.py chr_tilesets.s \
+#       tileset_bg_main=game_tileset_1.chr@0 tileset_spr=game_tileset_1.chr@0x1000 \
+#       tileset_bg_crossroads=assets/chr/crossroads_bg.chr:banked
+
+import sys
+
+TABLE_SIZE = 0x1000
+
+
+def rle_pack(data):
+    unused = sorted(set(range(256)) - set(data))
+    if not unused:
+        raise ValueError("every byte value is used, no RLE tag available")
+    tag = unused[0]
+    out = [tag]
+    i = 0
+    while i < len(data):
+        b = data[i]
+        run = 1
+        while i + run < len(data) and data[i + run] == b and run < 256:
+            run += 1
+        out.append(b)
+        if run == 2:
+            out.append(b)  # a second literal is shorter than tag + count
+        elif run > 2:
+            out += [tag, run - 1]
+        i += run
+    out += [tag, 0]
+    return bytes(out)
+
+
+def rle_unpack(packed):
+    tag = packed[0]
+    out = []
+    i = 1
+    while True:
+        b = packed[i]
+        i += 1
+        if b != tag:
+            out.append(b)
+            continue
+        n = packed[i]
+        i += 1
+        if n == 0:
+            return bytes(out)
+        out += [out[-1]] * n
+
+
+def main(argv):
+    if len(argv) < 3:
+        sys.stderr.write("usage: chr_pack.py OUT.s NAME=FILE.chr[@OFFSET] ...\n")
+        return 1
+
+    lines = [
+        "; Generated by tools/chr_pack.py, do not edit",
+        ";" + " ".join(argv[2:]),
+        "",
+        "\t.include \"mapper.inc\"",
+        "",
+        ".if(NES_CHR_RAM)",
+        "",
+        "\t.export NES_CHR_BANKS\t;no CHR-ROM in the iNES header",
+        "NES_CHR_BANKS = 0",
+        "",
+        ".segment \"TILESETS\"\t;switchable bank on MMC1/MMC3, see mapper.h",
+    ]
+    total = 0
+
+    for arg in argv[2:]:
+        name, src = arg.split("=", 1)
+        banked = src.endswith(":banked")
+        if banked:
+            src = src[:-len(":banked")]
+        offset = 0
+        if "@" in src:
+            src, off = src.split("@", 1)
+            offset = int(off, 0)
+        with open(src, "rb") as f:
+            data = f.read()[offset:offset + TABLE_SIZE]
+        if len(data) != TABLE_SIZE:
+            raise ValueError("%s: need %d bytes at offset %d" % (src, TABLE_SIZE, offset))
+
+        packed = rle_pack(data)
+        assert rle_unpack(packed) == data
+        total += len(packed)
+
+        lines += [""]
+        if banked:
+            lines += [".if(NES_MAPPER <> 0)\t;banked builds only", ""]
+        lines += ["\t.export _%s" % name, "", "_%s:\t;%d bytes (%d%%)" %
+                  (name, len(packed), len(packed) * 100 // TABLE_SIZE)]
+        for i in range(0, len(packed), 16):
+            lines.append("\t.byte " + ",".join("$%02x" % b for b in packed[i:i + 16]))
+        if banked:
+            lines += ["", ".endif"]
+
+    lines += ["", ".endif", ""]
+
+    with open(argv[1], "w") as f:
+        f.write("\n".join(lines))
+    sys.stderr.write("%s: %d bytes\n" % (argv[1], total))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
@@ -0,0 +1,220 @@
+#!/usr/bin/env python3
+#------------------------------------------------------------------------------//
+#        chr_usage.py - CHR tile usage report and duplicate tile packing       //
+#------------------------------------------------------------------------------//
+
+# Finds which tiles of a CHR file the game really uses, and which ones are
+# copies of each other, so tile slots can be freed.
+#
+# Tile references are collected from:
+#   background  every nametable source in assets/nametables.txt (960 tile
+#               bytes, attributes excluded), the dialogue font (characters of
+#               dialogue.txt), and tile constants in hollow_nes.c
+#               (#define TILE_*, vram_write("\x..") and vram_fill(0x..))
+#   sprites     every DEF_METASPRITE_*(name, code, pal) in hollow_nes.c, with
+#               the tile offsets read from the macro definitions themselves,
+#               plus 0x1NN tile literals in the code (oam_spr, ARROW_TILE, ...)
+#
+# For each 4K table the report lists unused tiles, pixel-identical duplicates
+# and flip duplicates (same pixels mirrored H, V or both; sprites could reuse
+# them through OAM flip bits, the background cannot).
+#
+# --pack DIR frees background slots without moving any tile: each unused tile
+# is blanked, and each exact duplicate is merged into its first copy, but only
+# when both have the same collision class and no code refers to the copy. DIR
+# receives the packed .chr, remapped copies of the .nam sources (DIR/nam/)
+# and remap.txt. Copy them over the originals and rerun tools/build_assets.py
+# (and tools/chr_pack.py for the CHR-RAM build).
+#
+# Usage (from the repository root):
+#   tools/chr_usage.py [FILE.chr ...]            report (default: both CHR files)
+#   tools/chr_usage.py --pack DIR FILE.chr       report and write the packed set
+
+import os
+import re
+import sys
+
+GAME_SOURCE = "hollow_nes.c"
+NAMETABLE_LIST = "assets/nametables.txt"
+DIALOGUE = "dialogue.txt"
+DEFAULT_CHR = ["game_tileset_1.chr", "hollow_nes_chr.chr"]
+
+TILE_BYTES = 16
+TABLE_TILES = 256
+NAM_TILES = 960
+
+
+def tiles_of(chr_data, table):
+    base = table * TABLE_TILES * TILE_BYTES
+    return [chr_data[base + i * TILE_BYTES:base + (i + 1) * TILE_BYTES] for i in range(TABLE_TILES)]
+
+
+def flip_h(tile):
+    return bytes(int("{:08b}".format(b)[::-1], 2) for b in tile)
+
+
+def flip_v(tile):
+    return tile[7::-1] + tile[15:7:-1]
+
+
+def nametable_sources():
+    out = []
+    with open(NAMETABLE_LIST) as f:
+        for line in f:
+            line = line.split("#", 1)[0].split()
+            if line:
+                out.append(line[1])
+    return out
+
+
+def collect_refs(src):
+    bg = {}   # tile -> set of places
+    spr = {}
+    pinned = set()  # background tiles named by code, must keep their index
+
+    def ref(table, tile, where):
+        table.setdefault(tile, set()).add(where)
+
+    for path in nametable_sources():
+        with open(path, "rb") as f:
+            for t in f.read()[:NAM_TILES]:
+                ref(bg, t, os.path.basename(path))
+
+    with open(DIALOGUE) as f:
+        for line in f:
+            if line.strip() and not line.startswith(("#", "[")):
+                for c in line.strip():
+                    ref(bg, ord(c), "font")
+                    pinned.add(ord(c))
+
+    for m in re.finditer(r"#define\s+TILE_\w+\s+(0x[0-9a-fA-F]+)", src):
+        ref(bg, int(m.group(1), 16), "TILE_*")
+        pinned.add(int(m.group(1), 16))
+    for m in re.finditer(r'vram_write\("((?:\\x[0-9a-fA-F]{2})+)"', src):
+        for h in re.findall(r"\\x([0-9a-fA-F]{2})", m.group(1)):
+            ref(bg, int(h, 16), "vram_write")
+            pinned.add(int(h, 16))
+    for m in re.finditer(r"vram_fill\((0x[0-9a-fA-F]+)", src):
+        ref(bg, int(m.group(1), 16), "vram_fill")
+        pinned.add(int(m.group(1), 16))
+
+    # Tile offsets of each metasprite shape, from the macro bodies
+    shapes = {}
+    for m in re.finditer(r"#define\s+(DEF_METASPRITE_\w+)\(name,code,pal\)((?:[^\n]*\\\n)*[^\n]*)", src):
+        shapes[m.group(1)] = sorted(set(int(o) for o in re.findall(r"\(code\)\+(\d+)", m.group(2))))
+    for m in re.finditer(r"^(DEF_METASPRITE_\w+)\((\w+),\s*(0x[0-9a-fA-F]+|\d+)", src, re.M):
+        code = int(m.group(3), 0)
+        for o in shapes[m.group(1)]:
+            ref(spr, (code + o) & 0xff, m.group(2))
+
+    for line in src.splitlines():
+        if line.startswith(("DEF_METASPRITE", "#define DEF_METASPRITE")):
+            continue
+        for h in re.findall(r"\b0x1([0-9a-fA-F]{2})\b", line):
+            ref(spr, int(h, 16), "code")
+
+    return bg, spr, pinned
+
+
+def duplicates(tiles, used):
+    exact = {}  # tile -> first tile with the same pixels
+    flips = {}  # tile -> (first tile, flip)
+    seen = {}
+    for i, t in enumerate(tiles):
+        if i not in used:
+            continue
+        if t in seen:
+            exact[i] = seen[t]
+            continue
+        for name, variant in (("H", flip_h(t)), ("V", flip_v(t)), ("HV", flip_h(flip_v(t)))):
+            if variant in seen and variant != t:
+                flips[i] = (seen[variant], name)
+                break
+        seen.setdefault(t, i)
+    return exact, flips
+
+
+def fmt(tiles):
+    return " ".join("$%02x" % t for t in sorted(tiles)) or "-"
+
+
+def report(path, chr_data, bg, spr):
+    print("%s" % path)
+    for table, name, refs in ((0, "background", bg), (1, "sprites", spr)):
+        tiles = tiles_of(chr_data, table)
+        used = set(refs)
+        blank = set(i for i, t in enumerate(tiles) if not any(t))
+        unused = set(range(TABLE_TILES)) - used
+        exact, flips = duplicates(tiles, used)
+        print("  %s ($%d000): %d used, %d unused (%d of them with pixels)" % (
+            name, table, len(used), len(unused), len(unused - blank)))
+        print("    unused with pixels: %s" % fmt(unused - blank))
+        print("    duplicates:         %s" % (" ".join("$%02x=$%02x" % (i, j) for i, j in sorted(exact.items())) or "-"))
+        print("    flip duplicates:    %s" % (" ".join("$%02x=%s($%02x)" % (i, f, j) for i, (j, f) in sorted(flips.items())) or "-"))
+    print("")
+
+
+def pack(out_dir, path, chr_data, bg, pinned, props):
+    tiles = tiles_of(chr_data, 0)
+    used = set(bg)
+    exact, _ = duplicates(tiles, used)
+    remap = {}
+    for i, j in exact.items():
+        if i not in pinned and props[i] == props[j]:
+            remap[i] = j
+    freed = (set(range(TABLE_TILES)) - used - pinned) | set(remap)
+
+    packed = bytearray(chr_data)
+    for i in freed:
+        packed[i * TILE_BYTES:(i + 1) * TILE_BYTES] = bytes(TILE_BYTES)
+
+    os.makedirs(os.path.join(out_dir, "nam"), exist_ok=True)
+    with open(os.path.join(out_dir, os.path.basename(path)), "wb") as f:
+        f.write(packed)
+    for src in nametable_sources():
+        with open(src, "rb") as f:
+            nam = bytearray(f.read())
+        for k in range(NAM_TILES):
+            nam[k] = remap.get(nam[k], nam[k])
+        with open(os.path.join(out_dir, "nam", os.path.basename(src)), "wb") as f:
+            f.write(nam)
+    with open(os.path.join(out_dir, "remap.txt"), "w") as f:
+        f.write("# background tile remap for %s (old new)\n" % path)
+        for i, j in sorted(remap.items()):
+            f.write("$%02x $%02x\n" % (i, j))
+    print("packed %s: %d background slots free, %d merged duplicates -> %s" % (
+        path, len(freed), len(remap), out_dir))
+
+
+def collision_properties(src):
+    body = re.search(r"collision_properties\[256\]\s*=\s*\{(.*?)\};", src, re.S).group(1)
+    body = re.sub(r"//[^\n]*", "", body)
+    return [int(v, 0) for v in re.findall(r"0x[0-9a-fA-F]+|\d+", body)]
+
+
+def main(argv):
+    out_dir = None
+    if len(argv) > 1 and argv[1] == "--pack":
+        if len(argv) != 4:
+            sys.stderr.write("usage: chr_usage.py --pack DIR FILE.chr\n")
+            return 1
+        out_dir = argv[2]
+        files = argv[3:]
+    else:
+        files = argv[1:] or DEFAULT_CHR
+
+    with open(GAME_SOURCE) as f:
+        src = f.read()
+    bg, spr, pinned = collect_refs(src)
+
+    for path in files:
+        with open(path, "rb") as f:
+            chr_data = f.read()
+        report(path, chr_data, bg, spr)
+        if out_dir:
+            pack(out_dir, path, chr_data, bg, pinned, collision_properties(src))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
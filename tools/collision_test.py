@@ -0,0 +1,196 @@
+#!/usr/bin/env python3
+#------------------------------------------------------------------------------//
+#      collision_test.py - Check collision_at() against the C tile lookup      //
+#------------------------------------------------------------------------------//
+
+# Runs _collision_at from collision.s, read straight from the source, in a
+# small 6502 interpreter and compares it with the C reference in hollow_nes.c
+# (get_tile_at() + collision_properties[]) for every (x, y) from 0 to 255.
+#
+# The room tile map is filled with a pattern where every tile differs from its
+# neighbours, and placed at several base addresses, page aligned or not, so a
+# wrong row, column or page carry shows up as a mismatch. collision_properties
+# maps each tile to a distinct value.
+#
+# Also reports the routine's cycle count (without the caller's jsr), best
+# and worst case, from the per-instruction timings.
+#
+# Usage (from the repository root):
+#   tools/collision_test.py [collision.s]
+#
+# The exit code is 1 on the first mismatch.
+
+import re
+import sys
+
+SOURCE = "collision.s"
+ROUTINE = "_collision_at"
+
+TILE_SHIFT = 3             # must match hollow_nes.c
+NAMETABLE_WIDTH_SHIFT = 5
+
+# Symbols the routine uses, at test addresses
+SYMBOLS = {
+    "_room_tiles": 0x10,
+    "ptr1": 0x12,
+    "tmp1": 0x14,
+    "_collision_properties": 0x0300,
+}
+ROOM_BASES = [0x0400, 0x04f0, 0x0581, 0x07ff]
+
+# Cycles per (mnemonic, addressing mode); +1 on a page cross for (zp),y and abs,x
+CYCLES = {
+    ("lsr", "acc"): 2, ("asl", "acc"): 2, ("rol", "acc"): 2,
+    ("sta", "zp"): 3, ("lda", "zp"): 3, ("ora", "zp"): 3, ("adc", "zp"): 3,
+    ("and", "imm"): 2, ("ldx", "imm"): 2, ("lda", "imm"): 2,
+    ("txa", "imp"): 2, ("tax", "imp"): 2, ("tay", "imp"): 2, ("clc", "imp"): 2,
+    ("lda", "izy"): 5, ("lda", "abx"): 4, ("rts", "imp"): 6,
+}
+
+
+#------------------------------- Source ---------------------------------------//
+
+def load_routine(path):
+    with open(path) as f:
+        lines = f.read().splitlines()
+    start = lines.index(ROUTINE + ":")
+    code = []
+    for line in lines[start + 1:]:
+        line = line.split(";", 1)[0].strip()
+        if not line:
+            continue
+        op, _, arg = line.partition(" ")
+        code.append((op.lower(), arg.strip()))
+        if op.lower() == "rts":
+            return code
+    raise ValueError("%s: no rts after %s" % (path, ROUTINE))
+
+
+def number(tok):
+    tok = tok.strip()
+    if tok.startswith("$"):
+        return int(tok[1:], 16)
+    if tok.startswith("%"):
+        return int(tok[1:], 2)
+    if re.match(r"^\d+$", tok):
+        return int(tok)
+    name, _, add = tok.partition("+")
+    return SYMBOLS[name.strip()] + (number(add) if add else 0)
+
+
+def decode(op, arg):
+    if not arg:
+        return ("imp", None) if op not in ("lsr", "asl", "rol", "ror") else ("acc", None)
+    if arg.lower() == "a":
+        return ("acc", None)
+    if arg.startswith("#"):
+        return ("imm", number(arg[1:]))
+    m = re.match(r"^\((\w+)\)\s*,\s*y$", arg, re.I)
+    if m:
+        return ("izy", number(m.group(1)))
+    m = re.match(r"^(.+?)\s*,\s*x$", arg, re.I)
+    if m:
+        return ("abx", number(m.group(1)))
+    addr = number(arg)
+    return ("zp" if addr < 0x100 else "abs", addr)
+
+
+#------------------------------- 6502 subset ----------------------------------//
+
+def run(code, mem, a, x):
+    y = 0
+    c = 0
+    cycles = 0
+    for op, arg in code:
+        mode, v = decode(op, arg)
+        if (op, mode) not in CYCLES:
+            raise ValueError("instruction not in the interpreter: %s %s" % (op, arg))
+        cycles += CYCLES[(op, mode)]
+
+        if mode == "imm":
+            m = v
+        elif mode in ("zp", "abs"):
+            m = mem[v]
+        elif mode == "izy":
+            base = mem[v] | (mem[v + 1] << 8)
+            addr = (base + y) & 0xffff
+            cycles += (base & 0xff00) != (addr & 0xff00)
+            m = mem[addr]
+        elif mode == "abx":
+            addr = (v + x) & 0xffff
+            cycles += (v & 0xff00) != (addr & 0xff00)
+            m = mem[addr]
+        else:
+            m = a
+
+        if op == "lsr":
+            c, a = a & 1, a >> 1
+        elif op == "asl":
+            c, a = a >> 7, (a << 1) & 0xff
+        elif op == "rol":
+            c, a = a >> 7, ((a << 1) | c) & 0xff
+        elif op == "and":
+            a &= m
+        elif op == "ora":
+            a |= m
+        elif op == "adc":
+            r = a + m + c
+            c, a = r >> 8, r & 0xff
+        elif op == "clc":
+            c = 0
+        elif op == "lda":
+            a = m
+        elif op == "ldx":
+            x = m
+        elif op == "sta":
+            mem[v] = a
+        elif op == "txa":
+            a = x
+        elif op == "tax":
+            x = a
+        elif op == "tay":
+            y = a
+        elif op == "rts":
+            break
+    return a, x, cycles
+
+
+#------------------------------- Reference ------------------------------------//
+
+def get_tile_at(room, x, y):
+    tile_x = x >> TILE_SHIFT
+    tile_y = y >> TILE_SHIFT
+    return room[tile_x + (tile_y << NAMETABLE_WIDTH_SHIFT)]
+
+
+def main(argv):
+    path = argv[1] if len(argv) > 1 else SOURCE
+    code = load_routine(path)
+
+    room = [(i * 7 + (i >> 5) * 3) & 0xff for i in range(1024)]
+    props = [(t * 37 + 11) & 0xff for t in range(256)]
+    lo, hi = 1 << 16, 0
+
+    for base in ROOM_BASES:
+        mem = bytearray(0x10000)
+        mem[SYMBOLS["_room_tiles"]] = base & 0xff
+        mem[SYMBOLS["_room_tiles"] + 1] = base >> 8
+        mem[SYMBOLS["_collision_properties"]:SYMBOLS["_collision_properties"] + 256] = bytes(props)
+        mem[base:base + 1024] = bytes(room)
+        for y in range(256):
+            for x in range(256):
+                a, rx, cycles = run(code, mem, x, y)
+                want = props[get_tile_at(room, x, y)]
+                if a != want or rx != 0:
+                    print("%s: mismatch at room $%04x x=%d y=%d: got A=$%02x X=$%02x, want A=$%02x X=$00"
+                          % (path, base, x, y, a, rx, want))
+                    return 1
+                lo, hi = min(lo, cycles), max(hi, cycles)
+
+    print("%s: %s matches get_tile_at() for all 65536 (x, y) at %d room addresses, %d-%d cycles"
+          % (path, ROUTINE, len(ROOM_BASES), lo, hi))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
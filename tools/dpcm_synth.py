@@ -0,0 +1,107 @@
+#!/usr/bin/env python3
+#------------------------------------------------------------------------------//
+#        dpcm_synth.py - Synthesize the DPCM sound effects in assets/dpcm/      //
+#------------------------------------------------------------------------------//
+
+# The two DMC samples are not recordings: they are synthesized here from the
+# recipes below and delta-encoded the way the DMC plays them back, so they
+# can be remade or tuned without any audio editor.
+#
+#   impact.dmc   nail hitting a Crawlid, rate 15 (33.1 kHz): a noise burst
+#                with a fast decay over a short 180 Hz knock
+#   thud.dmc     player taking damage, rate 13 (21.3 kHz): a sine falling
+#                from 110 to 45 Hz with a slower decay and a noisy onset
+#
+# The noise comes from a fixed LCG seed, so the output is the same on every
+# run. The DMC plays 1-bit deltas: each bit moves the 7-bit output level up or
+# down by 2, starting from the 32 sample_play() writes to $4011, and bits go
+# out LSB first. The encoder follows the waveform with that rule; the end of
+# each sample is silence (alternating bits around the start level).
+#
+# Sample lengths are fixed at 16 * n + 1 bytes (the DMC length register), the
+# same as the music_pack.py padding, so the DPCM area in the .cfg files
+# (NES_DPCM_BYTES) does not change when a recipe is tuned.
+#
+# Usage (from the repository root, then rerun music_pack.py, see music_data.s):
+#   tools/dpcm_synth.py [DIR]
+#
+# DIR defaults to assets/dpcm.
+
+import math
+import os
+import sys
+
+CPU_HZ = 1789773          # NTSC
+DMC_PERIOD = [            # CPU cycles per DMC bit, by rate 0-15
+    428, 380, 340, 320, 286, 254, 226, 214, 190, 160, 142, 128, 106, 84, 72, 54]
+DAC_START = 32            # sample_play() resets the DMC level to this (famitone2.s)
+AMPLITUDE = 30            # peak swing around DAC_START, in DMC levels
+SEED = 0x2b1d
+
+
+#------------------------------- Recipes --------------------------------------//
+
+def noise(seed):
+    x = seed
+    while True:
+        x = (x * 1103515245 + 12345) & 0x7fffffff
+        yield (x >> 15) / 32768.0 * 2 - 1
+
+
+def impact(t, n):
+    burst = n * math.exp(-t / 0.012)
+    knock = math.sin(2 * math.pi * 180 * t) * math.exp(-t / 0.025)
+    return 0.7 * burst + 0.5 * knock
+
+
+def thud(t, n):
+    # Phase of a sweep from 110 Hz to 45 Hz with a 30 ms time constant
+    f0, f1, tau = 110.0, 45.0, 0.030
+    phase = 2 * math.pi * (f1 * t + (f0 - f1) * tau * (1 - math.exp(-t / tau)))
+    return math.sin(phase) * math.exp(-t / 0.045) + 0.3 * n * math.exp(-t / 0.006)
+
+
+# name, recipe, rate, bytes (16 * n + 1)
+SAMPLES = [
+    ("impact.dmc", impact, 15, 321),
+    ("thud.dmc", thud, 13, 305),
+]
+
+
+#------------------------------- Encoder --------------------------------------//
+
+def encode(recipe, rate, size):
+    hz = CPU_HZ / DMC_PERIOD[rate]
+    level = DAC_START
+    rnd = noise(SEED)
+    out = bytearray()
+    peak = 0
+    for i in range(size):
+        byte = 0
+        for bit in range(8):
+            t = (i * 8 + bit) / hz
+            s = max(-1.0, min(1.0, recipe(t, next(rnd))))
+            target = DAC_START + s * AMPLITUDE
+            if target > level and level <= 125:
+                level += 2
+                byte |= 1 << bit
+            elif level >= 2:
+                level -= 2
+            peak = max(peak, abs(level - DAC_START))
+        out.append(byte)
+    return bytes(out), hz, peak
+
+
+def main(argv):
+    out_dir = argv[1] if len(argv) > 1 else os.path.join("assets", "dpcm")
+    for name, recipe, rate, size in SAMPLES:
+        data, hz, peak = encode(recipe, rate, size)
+        with open(os.path.join(out_dir, name), "wb") as f:
+            f.write(data)
+        sys.stderr.write("%-11s rate %2d (%.0f Hz), %d bytes, %.0f ms, peak %d levels\n" % (
+            name, rate, hz, size, size * 8 * 1000 / hz, peak))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
@@ -0,0 +1,196 @@
+#!/usr/bin/env python3
+#------------------------------------------------------------------------------//
+#        dte_pack.py - Compile the dialogue script into DTE-packed text        //
+#------------------------------------------------------------------------------//
+
+# Reads dialogue.txt, word-wraps every page to the dialogue box and compresses
+# the text with DTE (dual tile encoding): the most frequent character pairs
+# get one-byte codes $80-$FF. The game decodes it a byte at a time with
+# dialogue_next() in hollow_nes.c.
+#
+# Encoded page:
+#   $20-$5F     character, written as is (tile number)
+#   $80-$FF     pair dte_first[code-$80], dte_second[code-$80]
+#   $0A         next line of the box
+#   $00         end of page
+#   $01         end of page and of the conversation
+#
+# Outputs:
+#   dialogue_data.s   pair tables, page offsets and text (segment DIALOGUE)
+#   dialogue.h        DIALOGUE_<NAME> first-page indices and declarations
+#
+# Usage:
+#   tools/dte_pack.py dialogue.txt dialogue_data.s dialogue.h
+
+import sys
+from collections import Counter
+
+BOX_COLUMNS = 24
+BOX_LINES = 3
+
+DLG_END_PAGE = 0x00
+DLG_END = 0x01
+DLG_NEWLINE = 0x0A
+DTE_FIRST = 0x80
+DTE_CODES = 0x80
+
+
+def parse(path):
+    convs = []  # (name, [page text, ...])
+    with open(path) as f:
+        for n, line in enumerate(f, 1):
+            line = line.strip()
+            if not line or line.startswith("#"):
+                continue
+            if line.startswith("[") and line.endswith("]"):
+                convs.append((line[1:-1].upper(), []))
+                continue
+            if not convs:
+                raise ValueError("%s:%d: page before the first [NAME]" % (path, n))
+            bad = [c for c in line if not 0x20 <= ord(c) <= 0x5F]
+            if bad:
+                raise ValueError("%s:%d: characters not in the font: %r" % (path, n, "".join(bad)))
+            convs[-1][1].append((n, line))
+    return convs
+
+
+def wrap(path, n, text):
+    lines = [""]
+    for word in text.split():
+        if len(word) > BOX_COLUMNS:
+            raise ValueError("%s:%d: word longer than the box: %s" % (path, n, word))
+        if not lines[-1]:
+            lines[-1] = word
+        elif len(lines[-1]) + 1 + len(word) <= BOX_COLUMNS:
+            lines[-1] += " " + word
+        else:
+            lines.append(word)
+    if len(lines) > BOX_LINES:
+        raise ValueError("%s:%d: page needs %d lines, the box has %d" % (path, n, len(lines), BOX_LINES))
+    return lines
+
+
+def dte(pages):
+    # pages: lists of byte values (characters and DLG_NEWLINE), without terminators
+    pairs = []
+    while len(pairs) < DTE_CODES:
+        count = Counter()
+        for p in pages:
+            for a, b in zip(p, p[1:]):
+                if 0x20 <= a < DTE_FIRST and 0x20 <= b < DTE_FIRST:
+                    count[(a, b)] += 1
+        if not count:
+            break
+        pair, freq = count.most_common(1)[0]
+        if freq <= 2:  # a table entry costs 2 bytes
+            break
+        code = DTE_FIRST + len(pairs)
+        pairs.append(pair)
+        for i, p in enumerate(pages):
+            out = []
+            j = 0
+            while j < len(p):
+                if j + 1 < len(p) and (p[j], p[j + 1]) == pair:
+                    out.append(code)
+                    j += 2
+                else:
+                    out.append(p[j])
+                    j += 1
+            pages[i] = out
+    return pairs
+
+
+def byte_lines(data):
+    return ["\t.byte " + ",".join("$%02x" % b for b in data[i:i + 16]) for i in range(0, len(data), 16)]
+
+
+def main(argv):
+    if len(argv) != 4:
+        sys.stderr.write("usage: dte_pack.py dialogue.txt dialogue_data.s dialogue.h\n")
+        return 1
+    src, out_s, out_h = argv[1:]
+
+    convs = parse(src)
+    pages = []
+    last = []
+    starts = []
+    plain = 0
+    for name, conv in convs:
+        starts.append((name, len(pages)))
+        for i, (n, text) in enumerate(conv):
+            lines = wrap(src, n, text)
+            page = []
+            for k, line in enumerate(lines):
+                if k:
+                    page.append(DLG_NEWLINE)
+                page += [ord(c) for c in line]
+            pages.append(page)
+            last.append(i == len(conv) - 1)
+            plain += len(text) + 1
+
+    pairs = dte(pages)
+
+    text = []
+    offsets = []
+    for page, end in zip(pages, last):
+        offsets.append(len(text))
+        text += page + [DLG_END if end else DLG_END_PAGE]
+    packed = len(text) + 2 * len(pairs) + 2 * len(offsets)
+
+    s = [
+        "; Generated by tools/dte_pack.py from %s, do not edit" % src,
+        "; %d pages, %d pairs, %d bytes (plain text %d bytes)" % (len(pages), len(pairs), packed, plain),
+        "",
+        "\t.export _dte_first,_dte_second,_dialogue_pages,_dialogue_text",
+        "",
+        ".segment \"DIALOGUE\"\t;switchable bank on MMC1/MMC3, see mapper.h",
+        "",
+        "_dte_first:",
+    ] + byte_lines([a for a, b in pairs] or [0]) + [
+        "",
+        "_dte_second:",
+    ] + byte_lines([b for a, b in pairs] or [0]) + [
+        "",
+        "_dialogue_pages:",
+    ] + ["\t.word " + ",".join("%d" % o for o in offsets[i:i + 8]) for i in range(0, len(offsets), 8)] + [
+        "",
+        "_dialogue_text:",
+    ] + byte_lines(text) + [""]
+    with open(out_s, "w") as f:
+        f.write("\n".join(s))
+
+    h = [
+        "// Generated by tools/dte_pack.py from %s, do not edit" % src,
+        "",
+        "#ifndef _DIALOGUE_H",
+        "#define _DIALOGUE_H",
+        "",
+        "// First page of each conversation",
+    ] + ["#define DIALOGUE_%s %d" % (name, start) for name, start in starts] + [
+        "",
+        "#define DIALOGUE_PAGES %d" % len(pages),
+        "",
+        "// Page control codes, see dialogue_next()",
+        "#define DLG_END_PAGE 0x%02x" % DLG_END_PAGE,
+        "#define DLG_END      0x%02x" % DLG_END,
+        "#define DLG_NEWLINE  0x%02x" % DLG_NEWLINE,
+        "#define DTE_FIRST    0x%02x" % DTE_FIRST,
+        "",
+        "// DTE-packed text (segment DIALOGUE, bank BANK_DIALOGUE)",
+        "extern const unsigned char dte_first[];",
+        "extern const unsigned char dte_second[];",
+        "extern const unsigned int dialogue_pages[DIALOGUE_PAGES];",
+        "extern const unsigned char dialogue_text[];",
+        "",
+        "#endif // dialogue.h",
+        "",
+    ]
+    with open(out_h, "w") as f:
+        f.write("\n".join(h))
+
+    sys.stderr.write("%s: %d pages, %d pairs, %d -> %d bytes\n" % (out_s, len(pages), len(pairs), plain, packed))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
@@ -0,0 +1,198 @@
+--------------------------------------------------------------------------------//
+--    input_latency.lua - Frames from a button press to the screen (Mesen)     //
+--------------------------------------------------------------------------------//
+
+-- Runs the game without a window and measures, for each action below, how
+-- many frames pass between the controller poll that first sees the press and
+-- the end of the first frame the PPU draws differently because of it.
+--
+-- Every test is played twice from the same savestate: a control run without
+-- the press, then the run with it. At the end of each frame the script copies
+-- what the PPU shows (OAM, nametable RAM, palette RAM) and the first frame
+-- where the two runs differ is the response. Idle animations, Crawlids and
+-- the music are the same in both runs, so they do not count as a response.
+--
+--   jump       A on the ground (player sprite moves up)
+--   attack     B (strike sprite appears)
+--   dialogue   A on an open Elderbug dialogue page (next page is drawn)
+--
+-- The game polls the pad after the NMI and its OAM goes out at the following
+-- NMI, so 2 frames is the floor: the logic frame, then the frame that shows
+-- it. Anything above that is time the press waited behind blocking code
+-- (wait_frames(), ppu_off() loads, lag frames). Compare a default build with
+-- an INPUT_NMI_LATCH build (input.h) to see what the NMI latch changes.
+--
+-- Usage (build, then):
+--   Mesen --testRunner hollow_nes.nes tools/input_latency.lua
+--
+-- The exit code is the number of actions slower than MAX_LATENCY frames or
+-- without any response, 0 if all of them respond in time.
+
+local MAX_LATENCY = 3           -- frames, poll to first changed frame
+local WINDOW = 60               -- frames recorded per run
+local BOOT_FRAMES = 400         -- menu, fade in, player lands in ROOM_START
+local SETTLE = 45               -- idle frames before each test (jump lands, cooldowns end)
+local SETUP_LIMIT = 900         -- frames to reach a test's starting point
+local FRAME_MS = 1000 / 60.0988 -- NTSC
+
+-- Tests: name, button pressed, frames held, setup
+local TESTS = {
+  { name = "jump", button = "a", hold = 10, setup = "settle" },
+  { name = "attack", button = "b", hold = 3, setup = "settle" },
+  { name = "dialogue", button = "a", hold = 3, setup = "elderbug" },
+}
+
+local frame = 0
+local phase = "boot"            -- boot, setup, control, press, done
+local test = 1
+local phase_frame = 0           -- frames since the phase started
+local pad = {}                  -- buttons for the next poll
+local state = nil               -- savestate both runs start from
+local control, pressed = {}, {} -- display hash per frame of each run
+local poll_at = nil             -- frames into the press run when the press was seen
+local nametable_prev = nil
+local nametable_changed_last = false
+local opened_at = nil           -- setup frame the dialogue box appeared
+local failed = 0
+local results = {}
+
+local function out(s)
+  emu.log(s)
+  print(s)
+end
+
+local function dump(memType, size)
+  local t = {}
+  for i = 0, size - 1 do
+    t[#t + 1] = string.char(emu.read(i, memType, false))
+  end
+  return table.concat(t)
+end
+
+local function start_phase(p)
+  phase = p
+  phase_frame = 0
+end
+
+-- Setup: buttons for this frame, or true once the test can start
+local setups = {}
+
+function setups.settle(t)
+  if t < SETTLE then return {} end
+  return true
+end
+
+-- From the start position walk right in short steps; after each step stand
+-- still until the player is idle again (STATE_CHANGE_DELAY) and press UP.
+-- Next to Elderbug that opens the dialogue box, which redraws the nametable.
+function setups.elderbug(t, nametable_changed)
+  if opened_at then
+    if t - opened_at < SETTLE then return {} end
+    return true
+  end
+  if nametable_changed and t > SETTLE then
+    opened_at = t
+    return {}
+  end
+  if t < SETTLE then return {} end
+  local c = (t - SETTLE) % 24
+  if c < 6 then return { right = true } end
+  if c >= 18 and c < 20 then return { up = true } end
+  return {}
+end
+
+local function report(t)
+  local latency, changed = nil, false
+  for i = 1, WINDOW do
+    if control[i] ~= pressed[i] then
+      changed = true
+      if poll_at then latency = i - poll_at end
+      break
+    end
+  end
+  local line
+  if not poll_at then
+    line = string.format("  %-9s press never polled", t.name)
+    failed = failed + 1
+  elseif not changed then
+    line = string.format("  %-9s no change in %d frames", t.name, WINDOW)
+    failed = failed + 1
+  else
+    line = string.format("  %-9s %d frames (%.1f ms)", t.name, latency, latency * FRAME_MS)
+    if latency > MAX_LATENCY then
+      line = line .. string.format("  over %d frames", MAX_LATENCY)
+      failed = failed + 1
+    end
+  end
+  results[#results + 1] = line
+end
+
+emu.addEventCallback(function()
+  local t = TESTS[test]
+  phase_frame = phase_frame + 1
+
+  if phase == "boot" then
+    pad = (frame >= 90 and frame <= 95) and { start = true } or {}
+    if frame >= BOOT_FRAMES then start_phase("setup") end
+
+  elseif phase == "setup" then
+    local r = setups[t.setup](phase_frame, phase_frame > 1 and nametable_changed_last)
+    if r == true then
+      state = emu.createSavestate()
+      control, pressed = {}, {}
+      pad = {}
+      start_phase("control")
+    elseif phase_frame > SETUP_LIMIT then
+      results[#results + 1] = string.format("  %-9s setup did not reach the starting point", t.name)
+      failed = failed + 1
+      test = test + 1
+      opened_at = nil
+      pad = {}
+      start_phase(TESTS[test] and "setup" or "done")
+    else
+      pad = r
+    end
+
+  elseif phase == "control" and #control >= WINDOW then
+    emu.loadSavestate(state)
+    poll_at = nil
+    start_phase("press")
+  end
+
+  if phase == "press" then
+    if #pressed >= WINDOW then
+      report(t)
+      test = test + 1
+      opened_at = nil
+      pad = {}
+      start_phase(TESTS[test] and "setup" or "done")
+    else
+      pad = #pressed < t.hold and { [t.button] = true } or {}
+    end
+  end
+end, emu.eventType.startFrame)
+
+emu.addEventCallback(function()
+  if phase == "press" and not poll_at and next(pad) then
+    poll_at = #pressed
+  end
+  emu.setInput(pad, 0)
+end, emu.eventType.inputPolled)
+
+emu.addEventCallback(function()
+  frame = frame + 1
+  local nametable = dump(emu.memType.nesNametableRam, 0x800)
+  local display = dump(emu.memType.nesSpriteRam, 0x100) .. nametable .. dump(emu.memType.nesPaletteRam, 0x20)
+  nametable_changed_last = nametable_prev ~= nil and nametable ~= nametable_prev
+  nametable_prev = nametable
+
+  if phase == "control" then
+    control[#control + 1] = display
+  elseif phase == "press" then
+    pressed[#pressed + 1] = display
+  elseif phase == "done" then
+    out(string.format("input_latency: poll to first changed frame, limit %d frames", MAX_LATENCY))
+    for _, line in ipairs(results) do out(line) end
+    emu.stop(math.min(failed, 255))
+  end
+end, emu.eventType.endFrame)
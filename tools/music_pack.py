@@ -0,0 +1,461 @@
+#!/usr/bin/env python3
+#------------------------------------------------------------------------------//
+#        music_pack.py - Merge FamiStudio song exports into one music set      //
+#------------------------------------------------------------------------------//
+
+# FamiStudio exports each song of this project as its own FamiTone2 data set
+# (assets/music/*.s). Switching between separate sets means a famitone_init()
+# per change, which resets the engine mid-transition. This tool merges the
+# exports into a single multi-song set, so the game calls famitone_init()
+# once and switches songs with music_play(n).
+#
+# The merge shares everything the songs have in common:
+#   envelopes    byte-identical envelopes are stored once
+#   instruments  instruments with the same duty and envelopes are stored once;
+#                the instrument changes in the streams ($80 + 2n) are
+#                renumbered to match
+#   patterns     a run of a later song's stream that repeats notes already
+#                stored for an earlier song becomes a reference ($ff rows,
+#                address) into that song, the same way FamiStudio shares
+#                patterns inside one song
+#
+# and reports the bytes saved against the separate exports.
+#
+# DPCM samples (NAME=file.dmc[:RATE], RATE 0-15, default 15) go into the
+# set's sample list for sample_play(). Their data goes to segment DPCM, each
+# sample on a 64-byte boundary as the DMC requires; the linker places the
+# segment in the fixed bank (FT_DPCM_OFF, NES_DPCM_BYTES in the .cfg files)
+# and fails the build if the samples do not fit.
+#
+# Outputs:
+#   music_data.s   the merged set, exported as _music_data (segment MUSIC),
+#                  and the sample data (segment DPCM)
+#   music.h        MUSIC_<NAME> song numbers, SAMPLE_<NAME> sample numbers
+#                  and the declaration
+#
+# Usage:
+#   tools/music_pack.py music_data.s music.h NAME=song.s ... [NAME=sample.dmc[:RATE] ...]
+#
+# Example (what music_data.s was generated with):
+#   tools/music_pack.py music_data.s music.h \
+#       MENU=assets/music/hollow_knight_theme.s GAME=assets/music/dirtmouth.s \
+#       HORNET=assets/music/hornet.s \
+#       IMPACT=assets/dpcm/impact.dmc:15 THUD=assets/dpcm/thud.dmc:13
+
+import re
+import sys
+
+CHANNELS = 5
+HEADER_BYTES = 5          # song count, instrument and sample list pointers
+SONG_BYTES = 14           # 5 channel pointers, NTSC and PAL tempo
+INSTRUMENT_BYTES = 8      # duty, 3 envelope pointers, padding
+REF_BYTES = 4             # $ff, rows, address
+MAX_REF_ROWS = 255
+SAMPLE_BYTES = 3          # DMC address, length and rate of each sample
+SAMPLE_ALIGN = 64         # DMC sample addresses are $c000 + 64 * n
+SAMPLE_MAX = 4081         # longest DMC sample, length register $ff
+MAX_SAMPLES = 63
+
+# Channel stream opcodes (see _FT2ChannelUpdate in famitone2.s)
+OP_SPEED = 0xfb           # + speed byte
+OP_LOOP = 0xfd            # + loop address
+OP_REF = 0xff             # + row count, reference address
+INSTRUMENT = 0x80         # even codes $80-$fe: $80 + 2 * instrument
+
+# Stream ops after parsing: (kind, bytes, label)
+#   "label"  position label, no bytes
+#   "row"    note or empty-row count: one row of a reference
+#   "inst"   instrument change
+#   "speed"  speed change
+#   "ref"    $ff rows + address of label
+#   "loop"   $fd + address of label
+
+
+def parse_value(tok):
+    tok = tok.strip()
+    if tok.startswith("$"):
+        return int(tok[1:], 16)
+    if tok.isdigit():
+        return int(tok)
+    return tok  # label expression
+
+
+def parse(path):
+    # -> list of items: ("label", name) / ("byte", [..], comment) / ("word", [..], comment)
+    items = []
+    with open(path) as f:
+        for line in f:
+            line = line.rstrip("\n")
+            code, _, comment = line.partition(";")
+            code = code.strip()
+            if not code:
+                continue
+            m = re.match(r"^(@?\w+):$", code)
+            if m:
+                items.append(("label", m.group(1)))
+                continue
+            m = re.match(r"^\.(byte|word)\s+(.*)$", code)
+            if m:
+                items.append((m.group(1), [parse_value(t) for t in m.group(2).split(",")], comment.strip()))
+    return items
+
+
+def parse_ops(items):
+    values = []  # flatten into labels, bytes and words
+    for it in items:
+        if it[0] == "label":
+            values.append(("label", it[1]))
+        else:
+            values += [(it[0], v) for v in it[1]]
+    ops = []
+    i = 0
+    while i < len(values):
+        kind, v = values[i]
+        if kind == "label":
+            ops.append(("label", [], v))
+            i += 1
+        elif v == OP_SPEED:
+            ops.append(("speed", [v, values[i + 1][1]], None))
+            i += 2
+        elif v == OP_LOOP:
+            ops.append(("loop", [v], values[i + 1][1]))
+            i += 2
+        elif v == OP_REF:
+            ops.append(("ref", [v, values[i + 1][1]], values[i + 2][1]))
+            i += 3
+        elif v >= INSTRUMENT and not v & 1:
+            ops.append(("inst", [v], None))
+            i += 1
+        else:
+            ops.append(("row", [v], None))
+            i += 1
+    return ops
+
+
+def op_size(op):
+    return len(op[1]) + (2 if op[2] is not None and op[0] != "label" else 0)
+
+
+class Song:
+    def __init__(self, name, path):
+        self.name = name
+        self.path = path
+        items = parse(path)
+        labels = [i for i, it in enumerate(items) if it[0] == "label"]
+
+        def section(start, end_prefix):
+            i = next(k for k in labels if items[k][1] == start)
+            out = []
+            for it in items[i + 1:]:
+                if it[0] == "label" and it[1].startswith(end_prefix):
+                    break
+                out.append(it)
+            return out
+
+        # Header: count, instruments, samples, then channels and tempo per song
+        head = [it for it in items[:labels[1]] if it[0] != "label"]
+        if head[0][1] != [1]:
+            raise ValueError("%s: expected a single-song export" % path)
+        self.channels = [head[3 + c][1][0] for c in range(CHANNELS)]
+        self.tempo = head[3 + CHANNELS][1]
+
+        # Instruments: duty byte, 3 envelope words, padding byte
+        inst = section("@instruments", "@env")
+        self.instruments = []
+        for k in range(0, len(inst), 3):
+            name = re.sub(r"^[0-9a-f]+ : ", "", inst[k][2])
+            self.instruments.append((inst[k][1][0], inst[k + 1][1], name))
+
+        # Envelopes: @envN followed by bytes, up to @samples
+        self.envelopes = {}
+        start = next(k for k in labels if items[k][1] == "@env0")
+        name = None
+        for it in items[start:]:
+            if it[0] == "label":
+                if it[1] == "@samples":
+                    break
+                name = it[1]
+                self.envelopes[name] = []
+            else:
+                self.envelopes[name] += it[1]
+
+        # DPCM samples are not supported by the merge
+        if section("@samples", "@song"):
+            raise ValueError("%s: DPCM samples are not supported" % path)
+
+        # Channel streams: everything from the first channel label on
+        first = next(k for k in labels if items[k][1] == self.channels[0])
+        self.ops = parse_ops(items[first:])
+
+        self.size = (HEADER_BYTES + SONG_BYTES + INSTRUMENT_BYTES * len(self.instruments) +
+                     sum(len(e) for e in self.envelopes.values()) + self.stream_bytes())
+
+    def stream_bytes(self):
+        return sum(op_size(op) for op in self.ops)
+
+
+def rename(label, song_index):
+    return re.sub(r"^@song\d+", "@song%d" % song_index, label)
+
+
+#------------------------------- Pattern sharing --------------------------------//
+
+def referenced(ops):
+    # Indices of the ops played through a reference: they must stay as they are,
+    # references do not nest
+    at = {op[2]: i for i, op in enumerate(ops) if op[0] == "label"}
+    inside = set()
+    for op in ops:
+        if op[0] == "ref":
+            i = at[op[2]]
+            rows = op[1][1]
+            while rows:
+                inside.add(i)
+                if ops[i][0] == "row":
+                    rows -= 1
+                i += 1
+    return inside
+
+
+def plain(op):
+    return op[0] in ("row", "inst", "speed")
+
+
+def share_patterns(target, sources, new_label):
+    # Replace runs of target that are already stored in one of the sources with
+    # references into them. Target is rewritten in place; returns the bytes saved.
+    starts = {}  # op bytes -> [(source number, index)] where a run may begin
+    for k, src in enumerate(sources):
+        for j, op in enumerate(src):
+            if plain(op):
+                starts.setdefault(tuple(op[1]), []).append((k, j))
+
+    locked = referenced(target)
+    wanted = {}  # (source number, index) -> label to insert there
+    out = []
+    saved = 0
+    i = 0
+    while i < len(target):
+        best = None  # (bytes, target ops, source number, index, rows)
+        if plain(target[i]) and i not in locked:
+            for k, j in starts.get(tuple(target[i][1]), []):
+                src = sources[k]
+                a, b = i, j
+                size = rows = 0
+                while a < len(target) and b < len(src):
+                    if src[b][0] == "label":  # positions only, the run goes on
+                        b += 1
+                        continue
+                    if not plain(target[a]) or a in locked or target[a] != src[b]:
+                        break
+                    size += op_size(target[a])
+                    a += 1
+                    b += 1
+                    if target[a - 1][0] == "row":
+                        rows += 1
+                        if rows > MAX_REF_ROWS:
+                            break
+                        # a reference ends on a row: only runs ending here count
+                        if best is None or size > best[0]:
+                            best = (size, a - i, k, j, rows)
+        if best and best[0] > REF_BYTES:
+            size, length, k, j, rows = best
+            label = wanted.setdefault((k, j), new_label())
+            out.append(("ref", [OP_REF, rows], label))
+            saved += size - REF_BYTES
+            i += length
+        else:
+            out.append(target[i])
+            i += 1
+    target[:] = out
+
+    for (k, j), label in sorted(wanted.items(), reverse=True):
+        sources[k].insert(j, ("label", [], label))
+    return saved
+
+
+#--------------------------------- Output ---------------------------------------//
+
+def emit_ops(ops):
+    lines = []
+    run = []
+
+    def flush():
+        for k in range(0, len(run), 24):
+            lines.append("\t.byte " + ", ".join("$%02x" % b for b in run[k:k + 24]))
+        del run[:]
+
+    for kind, data, label in ops:
+        if kind == "label":
+            flush()
+            lines.append("%s:" % label)
+        elif label is not None:
+            run += data
+            flush()
+            lines.append("\t.word %s" % label)
+        else:
+            run += data
+    flush()
+    return lines
+
+
+def load_sample(name, arg):
+    path, _, rate = arg.partition(":")
+    rate = int(rate) if rate else 15
+    with open(path, "rb") as f:
+        data = f.read()
+    if not 0 <= rate <= 15:
+        raise ValueError("%s: rate must be 0-15" % path)
+    if not data or len(data) > SAMPLE_MAX:
+        raise ValueError("%s: %d bytes, a DMC sample has 1-%d" % (path, len(data), SAMPLE_MAX))
+    # The DMC plays 16 * n + 1 bytes: pad with silence (alternating deltas)
+    data += b"\x55" * (-(len(data) - 1) % 16)
+    return name, data, rate
+
+
+def main(argv):
+    if len(argv) < 4:
+        sys.stderr.write("usage: music_pack.py music_data.s music.h NAME=song.s ...\n")
+        return 1
+    out_s, out_h = argv[1:3]
+    songs = []
+    samples = []      # (name, bytes, rate)
+    for arg in argv[3:]:
+        name, path = arg.split("=", 1)
+        if path.partition(":")[0].endswith(".dmc"):
+            samples.append(load_sample(name.upper(), path))
+        else:
+            songs.append(Song(name, path))
+    if len(samples) > MAX_SAMPLES:
+        raise ValueError("more than %d DPCM samples" % MAX_SAMPLES)
+
+    # Envelopes and instruments, shared by content
+    envelopes = []    # bytes
+    instruments = []  # (duty, envelope numbers, names)
+    for song in songs:
+        env_map = {}
+        for name, data in song.envelopes.items():
+            if data not in envelopes:
+                envelopes.append(data)
+            env_map[name] = envelopes.index(data)
+        song.inst_map = []
+        for duty, envs, name in song.instruments:
+            key = (duty, [env_map[e] for e in envs])
+            found = [k for k, inst in enumerate(instruments) if inst[:2] == key]
+            if found:
+                instruments[found[0]][2].append("%s %s" % (song.name, name))
+                song.inst_map.append(found[0])
+            else:
+                song.inst_map.append(len(instruments))
+                instruments.append((duty, key[1], ["%s %s" % (song.name, name)]))
+    if len(instruments) > 63:
+        raise ValueError("more than 63 instruments")
+
+    # Streams: renumber instruments and labels, then share patterns
+    streams = []
+    pattern_saved = 0
+    shared = [0]
+
+    def new_label():
+        shared[0] += 1
+        return "@shared%d" % (shared[0] - 1)
+
+    for i, song in enumerate(songs):
+        ops = []
+        for kind, data, label in song.ops:
+            if kind == "inst":
+                data = [INSTRUMENT + 2 * song.inst_map[(data[0] - INSTRUMENT) >> 1]]
+            ops.append((kind, data, rename(label, i) if label else label))
+        song.channels = [rename(c, i) for c in song.channels]
+        pattern_saved += share_patterns(ops, streams, new_label)
+        streams.append(ops)
+
+    s = [
+        "; Generated by tools/music_pack.py, do not edit",
+        ";" + " ".join(argv[3:]),
+        "",
+        ".segment \"MUSIC\"\t\t;switchable music bank on MMC1/MMC3, see mapper.h",
+        "",
+        ".export _music_data",
+        ".global FAMISTUDIO_DPCM_PTR",
+        "",
+        "_music_data:",
+        "\t.byte %d" % len(songs),
+        "\t.word @instruments",
+        "\t.word @samples-3",
+    ]
+    for i, song in enumerate(songs):
+        s.append("; %02x : %s" % (i, song.name))
+        s += ["\t.word %s" % c for c in song.channels]
+        s.append("\t.word %s" % ",".join(str(t) for t in song.tempo))
+    s += ["", "@instruments:"]
+    for k, (duty, envs, names) in enumerate(instruments):
+        s += ["\t.byte $%02x ; %02x : %s" % (duty, k, ", ".join(names)),
+              "\t.word %s" % ", ".join("@env%d" % e for e in envs),
+              "\t.byte $00"]
+    s.append("")
+    for k, data in enumerate(envelopes):
+        s += ["@env%d:" % k, "\t.byte " + ",".join("$%02x" % b for b in data)]
+    s += ["", "@samples:"]
+    for k, (name, data, rate) in enumerate(samples):
+        s.append("\t.byte <((dpcm_%s & $3fff) >> 6),$%02x,$%02x ; %02x : %s, %d bytes" % (
+            name.lower(), (len(data) - 1) >> 4, rate, k + 1, name, len(data)))
+    s.append("")
+    for ops in streams:
+        s += emit_ops(ops)
+    if samples:
+        s += ["", ".segment \"DPCM\"\t\t;DMC sample area in the fixed bank, see FT_DPCM_OFF in famitone2.s"]
+        for name, data, rate in samples:
+            s += ["", "\t.align %d" % SAMPLE_ALIGN, "dpcm_%s:" % name.lower()]
+            s += ["\t.byte " + ",".join("$%02x" % b for b in data[k:k + 16]) for k in range(0, len(data), 16)]
+    s.append("")
+    with open(out_s, "w") as f:
+        f.write("\n".join(s))
+
+    h = [
+        "// Generated by tools/music_pack.py, do not edit",
+        "",
+        "#ifndef _MUSIC_H",
+        "#define _MUSIC_H",
+        "",
+        "// Song numbers for music_play()",
+    ] + ["#define MUSIC_%s %d" % (song.name, i) for i, song in enumerate(songs)] + [
+        "",
+        "#define MUSIC_SONGS %d" % len(songs),
+        "",
+    ] + (["// DPCM sample numbers for sample_play()"] +
+         ["#define SAMPLE_%s %d" % (name, k + 1) for k, (name, data, rate) in enumerate(samples)] +
+         [""] if samples else []) + [
+        "// All songs in one FamiTone2 set (segment MUSIC, bank BANK_MUSIC)",
+        "extern char music_data[];",
+        "",
+        "#endif // music.h",
+        "",
+    ]
+    with open(out_h, "w") as f:
+        f.write("\n".join(h))
+
+    # Report against the separate exports
+    before = sum(song.size for song in songs)
+    env_before = sum(sum(len(e) for e in song.envelopes.values()) for song in songs)
+    env_after = sum(len(e) for e in envelopes)
+    inst_before = sum(len(song.instruments) for song in songs)
+    after = (HEADER_BYTES + SONG_BYTES * len(songs) + INSTRUMENT_BYTES * len(instruments) + env_after +
+             sum(op_size(op) for ops in streams for op in ops))
+    sys.stderr.write("%s: %d songs, %d -> %d bytes (%d saved)\n" % (out_s, len(songs), before, after, before - after))
+    sys.stderr.write("  headers      %d bytes\n" % ((len(songs) - 1) * HEADER_BYTES))
+    sys.stderr.write("  envelopes    %d -> %d, %d bytes\n" % (
+        sum(len(song.envelopes) for song in songs), len(envelopes), env_before - env_after))
+    sys.stderr.write("  instruments  %d -> %d, %d bytes\n" % (
+        inst_before, len(instruments), (inst_before - len(instruments)) * INSTRUMENT_BYTES))
+    sys.stderr.write("  patterns     %d shared runs, %d bytes\n" % (shared[0], pattern_saved))
+    if samples:
+        dpcm = sum(len(data) for name, data, rate in samples)
+        aligned = sum(-(-len(data) // SAMPLE_ALIGN) * SAMPLE_ALIGN for name, data, rate in samples[:-1])
+        sys.stderr.write("  samples      %d, list %d bytes, DPCM %d bytes (%d with alignment, see NES_DPCM_BYTES)\n" % (
+            len(samples), SAMPLE_BYTES * len(samples), dpcm, aligned + len(samples[-1][1])))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
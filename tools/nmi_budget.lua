@@ -0,0 +1,296 @@
+--------------------------------------------------------------------------------//
+--       nmi_budget.lua - Cycle budget of every NMI phase (headless Mesen)       //
+--------------------------------------------------------------------------------//
+
+-- Runs the NMI_PROFILE build of the game (profile.h) without a window, plays
+-- a scripted input sequence and times each frame in CPU cycles from the
+-- markers the game writes to $4018/$4019:
+--
+--   ppu    vblank start -> end of the neslib NMI (OAM DMA, update buffer,
+--          palette, scroll). Over VBLANK_CYCLES the last writes land while
+--          the PPU is already drawing: flagged as a vblank spill.
+--   audio  NMI callback (FamiTone tick, mapper work). It runs after the PPU
+--          work and eats into the main loop's time.
+--   logic  main loop, check_game_state() up to ppu_wait_nmi().
+--
+-- A frame whose NMI + logic runs past FRAME_CYCLES makes the game miss the
+-- next NMI (a lag frame). The report says when the frame would have fit
+-- without the audio tick.
+--
+-- DPCM samples steal CPU time: every sample byte the DMC fetches stalls the
+-- CPU for up to 4 cycles. The script follows the DMC registers ($4010, $4013,
+-- $4015) and counts, per frame, the fetches that land in the NMI and in the
+-- logic window, and reports a lag frame that the fetches pushed over the
+-- limit. A fetch during a $4016 read can also drop a controller bit: every
+-- pad_poll() (three strobed reads, majority vote in neslib) is checked for
+-- reads that disagree, and the ones where the vote fails are counted.
+--
+-- The summary also fits ppu cycles against the update buffer bytes the game
+-- reported (profile_vram) and prints how many bytes fit in vblank; use it to
+-- size CHR_STREAM_BYTES or any other per-frame upload.
+--
+-- Usage (set NMI_PROFILE to 1 in profile.h and mapper.inc, build, then):
+--   Mesen --testRunner hollow_nes.nes tools/nmi_budget.lua
+--
+-- The exit code is the number of flagged frames plus the pad polls a DMC
+-- fetch broke (capped at 255), 0 if the budget holds. A run where no DPCM
+-- sample played also fails, since it says nothing about the DMC cost.
+
+local FRAMES = 3600             -- one minute of play
+local VBLANK_CYCLES = 2270      -- NTSC: 20 lines x 341 dots / 3, minus NMI entry latency
+local FRAME_CYCLES = 29780      -- NTSC: 262 lines x 341 dots / 3
+local MAX_REPORTED = 40         -- flagged frames printed in full
+
+local PROFILE_NMI_PPU = 1       -- must match profile.h
+local PROFILE_NMI_AUDIO = 2
+local PROFILE_LOGIC = 3
+local PROFILE_IDLE = 4
+
+local DMC_STALL = 4             -- CPU cycles per DMC fetch (3 or 4, counted as 4)
+local DMC_PERIOD = {            -- NTSC CPU cycles per DMC bit, by rate 0-15
+  428, 380, 340, 320, 286, 254, 226, 214, 190, 160, 142, 128, 106, 84, 72, 54 }
+
+-- Input script: {first frame, last frame, buttons}
+local INPUT = {
+  { 90, 95, { start = true } },          -- menu -> game
+  { 200, 400, { right = true } },
+  { 260, 275, { a = true } },
+  { 320, 330, { b = true } },
+  { 420, 700, { left = true } },
+  { 480, 500, { a = true } },
+  { 720, 1500, { right = true } },
+  { 800, 815, { a = true } },
+  { 900, 905, { b = true } },
+  { 1000, 1020, { a = true } },
+  { 1100, 1105, { b = true } },
+  { 1600, 2400, { left = true } },
+  { 1700, 1715, { a = true } },
+  { 2500, 3400, { right = true } },
+  { 2600, 2620, { a = true } },
+}
+
+local frame = 0
+local nmi_start, ppu_end = nil, nil
+local nmi_bytes, pending_bytes = 0, 0
+local logic_start = nil
+local cur = nil                 -- the frame being measured
+local flagged = 0
+local printed = 0
+local stats = { ppu = {}, audio = {}, logic = {}, dmc = {}, dmc_logic = {} }
+local samples = {}              -- {bytes, ppu cycles}
+local spills, lags, audio_lags = 0, 0, 0
+local dmc_rate, dmc_length = 0, 0
+local dmc = nil                 -- sample playing: {start, stop, step} in cycles
+local dmc_lags = 0
+local pad_reads, pad_polls, pad_dmc, pad_diff, pad_lost = {}, 0, 0, 0, 0
+
+local function cycles()
+  return emu.getState()["cpu.cycleCount"]
+end
+
+local function out(s)
+  emu.log(s)
+  print(s)
+end
+
+local function add(list, v)
+  list[#list + 1] = v
+end
+
+-- DMC fetches between two cycle counts
+local function dmc_fetches(a, b)
+  if not dmc then return 0 end
+  a = math.max(a, dmc.start)
+  b = math.min(b, dmc.stop)
+  if b <= a then return 0 end
+  local first = (a - dmc.start + dmc.step - 1) // dmc.step
+  local last = (b - dmc.start - 1) // dmc.step
+  return math.max(0, last - first + 1)
+end
+
+local function flag(f, what)
+  flagged = flagged + 1
+  if printed < MAX_REPORTED then
+    printed = printed + 1
+    out(string.format("frame %5d: %-34s ppu %5d  audio %5d  logic %5d  dmc %4d  vram %3d bytes",
+      f.frame, what, f.ppu or -1, f.audio or -1, f.logic or -1, f.dmc or 0, f.bytes))
+  end
+end
+
+local function close_frame(f, idle)
+  if f.ppu then
+    add(stats.ppu, f.ppu)
+    add(samples, { f.bytes, f.ppu })
+    if f.ppu > VBLANK_CYCLES then
+      spills = spills + 1
+      flag(f, "vblank spill")
+    end
+  end
+  if f.audio then add(stats.audio, f.audio) end
+  if f.logic then add(stats.logic, f.logic) end
+  if idle then
+    f.dmc = DMC_STALL * dmc_fetches(f.start, idle)
+    if f.dmc > 0 then
+      add(stats.dmc, f.dmc)
+      if f.logic then add(stats.dmc_logic, DMC_STALL * dmc_fetches(idle - f.logic, idle)) end
+    end
+  end
+  if idle and idle - f.start > FRAME_CYCLES then
+    lags = lags + 1
+    if f.dmc > 0 and idle - f.start - f.dmc <= FRAME_CYCLES then
+      dmc_lags = dmc_lags + 1
+      flag(f, "lag frame (DMC fetches)")
+    elseif f.audio and idle - f.start - f.audio <= FRAME_CYCLES then
+      audio_lags = audio_lags + 1
+      flag(f, "lag frame (FamiTone tick overflow)")
+    else
+      flag(f, "lag frame")
+    end
+  end
+end
+
+emu.addEventCallback(function()
+  frame = frame + 1
+  nmi_start = cycles()
+  nmi_bytes, pending_bytes = pending_bytes, 0
+  ppu_end = nil
+  if cur and cur.in_logic then
+    return   -- logic still running: this NMI is lost to it, keep timing the frame
+  end
+  if cur and not cur.closed then
+    close_frame(cur, nil)   -- frame outside the main loop (fades, transitions)
+  end
+  cur = { frame = frame, start = nmi_start, bytes = nmi_bytes }
+end, emu.eventType.nmi)
+
+emu.addMemoryCallback(function(address, value)
+  if address == 0x4019 then
+    pending_bytes = value
+    return
+  end
+  local t = cycles()
+  if value == PROFILE_NMI_PPU and nmi_start then
+    ppu_end = t
+    if cur and cur.start == nmi_start then cur.ppu = t - nmi_start end
+  elseif value == PROFILE_NMI_AUDIO and ppu_end then
+    if cur and cur.start == nmi_start then cur.audio = t - ppu_end end
+  elseif value == PROFILE_LOGIC and cur then
+    logic_start = t
+    cur.in_logic = true
+  elseif value == PROFILE_IDLE and cur and logic_start then
+    cur.logic = t - logic_start
+    cur.in_logic = false
+    cur.closed = true
+    close_frame(cur, t)
+  end
+end, emu.callbackType.write, 0x4018, 0x4019)
+
+-- DMC: a sample starts when $4015 bit 4 goes on, and plays length * 16 + 1
+-- bytes, one fetch every 8 bits
+emu.addMemoryCallback(function(address, value)
+  local t = cycles()
+  if address == 0x4010 then
+    dmc_rate = value & 0x0f
+  elseif address == 0x4013 then
+    dmc_length = value * 16 + 1
+  elseif address == 0x4015 then
+    if value & 0x10 == 0 then
+      if dmc then dmc.stop = math.min(dmc.stop, t) end
+    elseif not dmc or t >= dmc.stop then
+      local step = 8 * DMC_PERIOD[dmc_rate + 1]
+      dmc = { start = t, stop = t + dmc_length * step, step = step }
+    end
+  end
+end, emu.callbackType.write, 0x4010, 0x4015)
+
+-- Controller: a write of 1 to $4016 starts a strobed read of 8 bits
+emu.addMemoryCallback(function(address, value)
+  if value & 1 == 1 then
+    if #pad_reads >= 3 then pad_reads = {} end
+    pad_reads[#pad_reads + 1] = { bits = 0, count = 0, dmc = dmc and cycles() < dmc.stop }
+  end
+end, emu.callbackType.write, 0x4016, 0x4016)
+
+emu.addMemoryCallback(function(address, value)
+  local r = pad_reads[#pad_reads]
+  if not r or r.count >= 8 then return end
+  r.bits = r.bits | ((value & 1) << r.count)
+  r.count = r.count + 1
+  if #pad_reads == 3 and r.count == 8 then
+    local a, b, c = pad_reads[1], pad_reads[2], pad_reads[3]
+    pad_polls = pad_polls + 1
+    if a.dmc or b.dmc or c.dmc then pad_dmc = pad_dmc + 1 end
+    if a.bits ~= b.bits or b.bits ~= c.bits then
+      pad_diff = pad_diff + 1
+      if a.bits ~= b.bits and a.bits ~= c.bits and b.bits ~= c.bits then pad_lost = pad_lost + 1 end
+    end
+    pad_reads = {}
+  end
+end, emu.callbackType.read, 0x4016, 0x4016)
+
+emu.addEventCallback(function()
+  local pad = {}
+  for _, step in ipairs(INPUT) do
+    if frame >= step[1] and frame <= step[2] then
+      for k, v in pairs(step[3]) do pad[k] = v end
+    end
+  end
+  emu.setInput(pad, 0)
+end, emu.eventType.inputPolled)
+
+local function summary(name, list)
+  if #list == 0 then
+    out(string.format("  %-6s no samples (is this an NMI_PROFILE build?)", name))
+    return
+  end
+  local lo, hi, sum = math.huge, 0, 0
+  for _, v in ipairs(list) do
+    lo = math.min(lo, v); hi = math.max(hi, v); sum = sum + v
+  end
+  out(string.format("  %-6s min %5d  avg %5d  max %5d cycles", name, lo, sum // #list, hi))
+end
+
+-- Least squares fit of ppu cycles = base + per_byte * bytes
+local function vram_capacity()
+  local n, sx, sy, sxx, sxy = 0, 0, 0, 0, 0
+  local sizes = {}
+  for _, s in ipairs(samples) do
+    n = n + 1
+    sx = sx + s[1]; sy = sy + s[2]
+    sxx = sxx + s[1] * s[1]; sxy = sxy + s[1] * s[2]
+    sizes[s[1]] = true
+  end
+  local distinct = 0
+  for _ in pairs(sizes) do distinct = distinct + 1 end
+  if distinct < 2 then
+    out("  update buffer: not enough distinct sizes to fit (stream a tileset, e.g. change area)")
+    return
+  end
+  local per_byte = (n * sxy - sx * sy) / (n * sxx - sx * sx)
+  local base = (sy - per_byte * sx) / n
+  out(string.format("  update buffer: %d + %.1f cycles/byte, %d bytes fit in vblank",
+    math.floor(base), per_byte, math.floor((VBLANK_CYCLES - base) / per_byte)))
+end
+
+emu.addEventCallback(function()
+  if frame < FRAMES then return end
+  out(string.format("nmi_budget: %d frames, vblank %d cycles, frame %d cycles", frame, VBLANK_CYCLES, FRAME_CYCLES))
+  summary("ppu", stats.ppu)
+  summary("audio", stats.audio)
+  summary("logic", stats.logic)
+  if #stats.dmc > 0 then
+    out(string.format("  dmc    %d frames with DPCM playing, DMA stall per frame:", #stats.dmc))
+    summary("  all", stats.dmc)
+    summary("  logic", stats.dmc_logic)
+  else
+    out("  dmc    no DPCM played (the input script must hit a Crawlid or take damage)")
+    flagged = flagged + 1         -- no DMC figures: not a valid run
+  end
+  vram_capacity()
+  out(string.format("  pad    %d polls, %d during DPCM, %d with disagreeing reads, %d lost (vote failed)",
+    pad_polls, pad_dmc, pad_diff, pad_lost))
+  flagged = flagged + pad_lost
+  out(string.format("  vblank spills %d, lag frames %d (%d caused by the FamiTone tick, %d by DMC fetches)",
+    spills, lags, audio_lags, dmc_lags))
+  emu.stop(math.min(flagged, 255))
+end, emu.eventType.endFrame)
@@ -0,0 +1,275 @@
+#!/usr/bin/env python3
+#------------------------------------------------------------------------------//
+#          render_rooms.py - Render rooms to PNG for visual diffs              //
+#------------------------------------------------------------------------------//
+
+# Draws rooms the way the PPU shows them (nametable + attributes, background
+# pattern table of the CHR file, PALETTE[] from hollow_nes.c) and writes one
+# PNG per room, so changes to the art, the asset pipeline or the compression
+# can be checked with an image diff instead of booting an emulator.
+#
+# Rooms come from rooms[] in hollow_nes.c, mapped to their .nam sources
+# through assets/nametables.txt. Screens listed there (menu, death) are drawn
+# too, without overlays.
+#
+# Overlays (--overlay, comma separated, default all):
+#   collision  tints tiles by collision_properties[] class
+#              (red solid, orange spike, blue dialogue, green bench)
+#   actors     player start, NPC from npcs[] and Crawlids from crawlids[]
+#   exits      green bar on each edge that leads to another room
+#
+# Rooms render in parallel, one process per core by default.
+#
+# Usage (from the repository root):
+#   tools/render_rooms.py [-o DIR] [--chr FILE] [--overlay LIST] [--scale N] [-j N] [NAME ...]
+#
+# NAME is a room (ROOM_2_1) or nametable (nametable_menu); default is all.
+# Output goes to build/rooms/NAME.png unless -o is given.
+
+import argparse
+import os
+import re
+import struct
+import sys
+import zlib
+from multiprocessing import Pool
+
+GAME_SOURCE = "hollow_nes.c"
+NAMETABLE_LIST = "assets/nametables.txt"
+
+WIDTH = 256
+HEIGHT = 240
+COLUMNS = 32
+ROWS = 30
+NAM_TILES = 960
+
+# 2C02 palette, RGB
+NES_RGB = [
+    0x666666, 0x002a88, 0x1412a7, 0x3b00a4, 0x5c007e, 0x6e0040, 0x6c0600, 0x561d00,
+    0x333500, 0x0b4800, 0x005200, 0x004f08, 0x00404d, 0x000000, 0x000000, 0x000000,
+    0xadadad, 0x155fd9, 0x4240ff, 0x7527fe, 0xa01acc, 0xb71e7b, 0xb53120, 0x994e00,
+    0x6b6d00, 0x388700, 0x0c9300, 0x008f32, 0x007c8d, 0x000000, 0x000000, 0x000000,
+    0xfffeff, 0x64b0ff, 0x9290ff, 0xc676ff, 0xf36aff, 0xfe6ecc, 0xfe8170, 0xea9e22,
+    0xbcbe00, 0x88d800, 0x5ce430, 0x45e082, 0x48cdde, 0x4f4f4f, 0x000000, 0x000000,
+    0xfffeff, 0xc0dfff, 0xd3d2ff, 0xe8c8ff, 0xfbc2ff, 0xfec4ea, 0xfeccc5, 0xf7d8a5,
+    0xe4e594, 0xcfef96, 0xbdf4ab, 0xb3f3cc, 0xb5ebf2, 0xb8b8b8, 0x000000, 0x000000,
+]
+
+CLASS_TINT = {1: (255, 0, 0), 2: (255, 140, 0), 3: (0, 120, 255), 4: (0, 200, 0)}
+EXIT_COLOR = (0, 255, 0)
+ACTOR_COLORS = {"player": (255, 255, 0), "npc": (0, 255, 255), "crawlid": (255, 0, 255)}
+
+
+#------------------------------- Game data ------------------------------------//
+
+def strip_comments(text):
+    return re.sub(r"//[^\n]*|/\*.*?\*/", "", text, flags=re.S)
+
+
+def c_array(src, name):
+    body = re.search(re.escape(name) + r"\[[^\]]*\]\s*=\s*\{(.*?)\};", src, re.S).group(1)
+    return strip_comments(body)
+
+
+def load_game():
+    with open(GAME_SOURCE) as f:
+        src = f.read()
+
+    defines = {}
+    for m in re.finditer(r"^#define\s+(\w+)\s+(0x[0-9a-fA-F]+|\d+)\b", src, re.M):
+        defines.setdefault(m.group(1), int(m.group(2), 0))
+
+    def value(tok):
+        tok = tok.strip()
+        return int(tok, 0) if re.match(r"^(0x[0-9a-fA-F]+|\d+)$", tok) else defines.get(tok)
+
+    game = {
+        "palette": [int(v, 0) for v in re.findall(r"0x[0-9a-fA-F]+|\d+", c_array(src, "const char PALETTE"))],
+        "collision": [int(v, 0) for v in re.findall(r"0x[0-9a-fA-F]+|\d+", c_array(src, "collision_properties"))],
+        "rooms": {},
+        "npcs": [],
+        "crawlids": [],
+        "start": (defines.get("PLAYER_INIT_X", 0), defines.get("PLAYER_INIT_Y", 0)),
+    }
+    start_room = re.search(r"#define\s+ROOM_START\s+(\w+)", src).group(1)
+
+    # rooms[]: nametable, codec, left, right, up, down, music, npc, ...
+    room_ids = {}
+    for m in re.finditer(r"^#define\s+(ROOM_\d+_\d+)\s+(\d+)", src, re.M):
+        room_ids[int(m.group(2))] = m.group(1)
+    for i, row in enumerate(re.findall(r"\{([^{}]*)\}", c_array(src, "const RoomDesc rooms"))):
+        f = [t.strip() for t in row.split(",")]
+        name = room_ids[i]
+        game["rooms"][name] = {
+            "nametable": f[0],
+            "exits": {"left": f[2], "right": f[3], "up": f[4], "down": f[5]},
+            "npc": value(f[7]) or 0,
+            "start": name == start_room,
+        }
+
+    # npcs[]: x, y, width, height, ...
+    for row in re.findall(r"\{([^{}]*)\}", c_array(src, "const NpcDesc npcs")):
+        f = [t.strip() for t in row.split(",")]
+        game["npcs"].append(tuple(value(t) or 0 for t in f[:4]))
+
+    # crawlids[]: x, direction, anim_frame, anim_delay, hp, state, room
+    for row in re.findall(r"\{([^{}]*)\}", c_array(src, "Crawlid crawlids")):
+        f = [t.strip() for t in row.split(",")]
+        game["crawlids"].append((value(f[0]), defines.get("CRAWLID_Y", 0), f[6]))
+
+    return game
+
+
+def load_nametable_list():
+    out = {}
+    with open(NAMETABLE_LIST) as f:
+        for line in f:
+            line = line.split("#", 1)[0].split()
+            if line:
+                out[line[0]] = line[1]
+    return out
+
+
+#------------------------------- Rendering ------------------------------------//
+
+def render(nam, chr_data, palette):
+    rgb = [NES_RGB[c & 0x3f] for c in palette]
+    px = [[(0, 0, 0)] * WIDTH for _ in range(HEIGHT)]
+    for ty in range(ROWS):
+        for tx in range(COLUMNS):
+            tile = nam[ty * COLUMNS + tx]
+            attr = nam[NAM_TILES + (ty >> 2) * 8 + (tx >> 2)]
+            pal = (attr >> (((ty & 2) << 1) | (tx & 2))) & 3
+            base = tile * 16
+            for r in range(8):
+                lo = chr_data[base + r]
+                hi = chr_data[base + r + 8]
+                row = px[ty * 8 + r]
+                for c in range(8):
+                    ci = ((lo >> (7 - c)) & 1) | (((hi >> (7 - c)) & 1) << 1)
+                    color = rgb[pal * 4 + ci] if ci else rgb[0]
+                    row[tx * 8 + c] = ((color >> 16) & 0xff, (color >> 8) & 0xff, color & 0xff)
+    return px
+
+
+def blend(p, color, alpha=0.4):
+    return tuple(int(a * (1 - alpha) + b * alpha) for a, b in zip(p, color))
+
+
+def rect(px, x, y, w, h, color):
+    for i in range(w):
+        for yy in (y, y + h - 1):
+            if 0 <= x + i < WIDTH and 0 <= yy < HEIGHT:
+                px[yy][x + i] = color
+    for j in range(h):
+        for xx in (x, x + w - 1):
+            if 0 <= xx < WIDTH and 0 <= y + j < HEIGHT:
+                px[y + j][xx] = color
+
+
+def overlay_collision(px, nam, props):
+    for ty in range(ROWS):
+        for tx in range(COLUMNS):
+            tint = CLASS_TINT.get(props[nam[ty * COLUMNS + tx]])
+            if tint:
+                for y in range(ty * 8, ty * 8 + 8):
+                    for x in range(tx * 8, tx * 8 + 8):
+                        px[y][x] = blend(px[y][x], tint)
+
+
+def overlay_exits(px, exits):
+    for edge, target in exits.items():
+        if target == "ROOM_NONE":
+            continue
+        for i in range(4):
+            for k in range(WIDTH if edge in ("up", "down") else HEIGHT):
+                x, y = {"left": (i, k), "right": (WIDTH - 1 - i, k),
+                        "up": (k, i), "down": (k, HEIGHT - 1 - i)}[edge]
+                px[y][x] = EXIT_COLOR
+
+
+def overlay_actors(px, name, room, game):
+    if room["start"]:
+        x, y = game["start"]
+        rect(px, x, y, 16, 16, ACTOR_COLORS["player"])
+    if room["npc"]:
+        x, y, w, h = game["npcs"][room["npc"]]
+        rect(px, x, y, w, h, ACTOR_COLORS["npc"])
+    for x, y, where in game["crawlids"]:
+        if where == name:
+            rect(px, x, y, 16, 8, ACTOR_COLORS["crawlid"])
+
+
+def write_png(path, px, scale):
+    raw = bytearray()
+    for row in px:
+        line = bytearray([0])
+        for p in row:
+            line += bytes(p) * scale
+        raw += bytes(line) * scale
+    w, h = WIDTH * scale, HEIGHT * scale
+
+    def chunk(kind, data):
+        c = struct.pack(">I", len(data)) + kind + data
+        return c + struct.pack(">I", zlib.crc32(kind + data) & 0xffffffff)
+
+    with open(path, "wb") as f:
+        f.write(b"\x89PNG\r\n\x1a\n")
+        f.write(chunk(b"IHDR", struct.pack(">IIBBBBB", w, h, 8, 2, 0, 0, 0)))
+        f.write(chunk(b"IDAT", zlib.compress(bytes(raw), 9)))
+        f.write(chunk(b"IEND", b""))
+
+
+def render_job(job):
+    name, source, room, game, chr_data, overlays, scale, out_dir = job
+    with open(source, "rb") as f:
+        nam = f.read()
+    px = render(nam, chr_data, game["palette"])
+    if room:
+        if "collision" in overlays:
+            overlay_collision(px, nam, game["collision"])
+        if "exits" in overlays:
+            overlay_exits(px, room["exits"])
+        if "actors" in overlays:
+            overlay_actors(px, name, room, game)
+    path = os.path.join(out_dir, name + ".png")
+    write_png(path, px, scale)
+    return path
+
+
+def main():
+    ap = argparse.ArgumentParser(description="Render rooms to PNG")
+    ap.add_argument("names", nargs="*", help="ROOM_x_y or nametable name (default: all)")
+    ap.add_argument("-o", "--out", default="build/rooms", help="output directory")
+    ap.add_argument("--chr", default="game_tileset_1.chr", help="CHR file (background table at $0000)")
+    ap.add_argument("--overlay", default="collision,actors,exits", help="overlays, or 'none'")
+    ap.add_argument("--scale", type=int, default=1, help="pixel scale")
+    ap.add_argument("-j", "--jobs", type=int, default=os.cpu_count(), help="parallel processes")
+    args = ap.parse_args()
+
+    game = load_game()
+    sources = load_nametable_list()
+    with open(args.chr, "rb") as f:
+        chr_data = f.read()[:0x1000]
+    overlays = set(args.overlay.split(",")) - {"none"}
+
+    by_nametable = {r["nametable"]: (n, r) for n, r in game["rooms"].items()}
+    jobs = []
+    for nt, source in sources.items():
+        name, room = by_nametable.get(nt, (nt, None))
+        if args.names and name not in args.names and nt not in args.names:
+            continue
+        jobs.append((name, source, room, game, chr_data, overlays, args.scale, args.out))
+    if not jobs:
+        sys.stderr.write("no matching rooms\n")
+        return 1
+
+    os.makedirs(args.out, exist_ok=True)
+    with Pool(max(1, args.jobs)) as pool:
+        for path in pool.imap_unordered(render_job, jobs):
+            print(path)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())